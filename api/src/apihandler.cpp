@@ -764,7 +764,7 @@ csdb::Transaction APIHandler::makeTransaction(const Transaction& transaction) {
 }
 
 std::string getDelimitedTransactionSigHex(const csdb::Transaction& tr) {
-    auto bs = fromByteArray(tr.to_byte_stream_for_sig());
+    auto bs = fromByteArray(*tr.signing_bytes());
     return std::string({' '}) + cs::Utils::byteStreamToHex(bs.data(), bs.length());
 }
 
@@ -914,8 +914,8 @@ std::optional<std::string> APIHandler::checkTransaction(const Transaction& trans
         auto msg = " Node is not syncronized or last round duration is too long.";
         return msg;
     }
-    auto bb = cTransaction.to_byte_stream_for_sig();
-    auto st = cs::Utils::byteStreamToHex(bb.data(), bb.size());
+    const auto bb = cTransaction.signing_bytes();
+    auto st = cs::Utils::byteStreamToHex(bb->data(), bb->size());
     cs::IterValidator::SimpleValidator::RejectCode err;
     csdb::AmountCommission countedFee;
     if (!cs::IterValidator::SimpleValidator::validate(cTransaction, blockchain_, solver_.smart_contracts(), &countedFee, &err)) {
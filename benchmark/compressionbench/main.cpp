@@ -0,0 +1,127 @@
+#include <framework.hpp>
+
+#include <vector>
+
+#include <csdb/address.hpp>
+#include <csdb/amount.hpp>
+#include <csdb/amount_commission.hpp>
+#include <csdb/currency.hpp>
+#include <csdb/transaction.hpp>
+
+#include <csnode/transactionspacket.hpp>
+
+#include <lib/system/console.hpp>
+#include <lib/system/random.hpp>
+
+#include <net/packetcompressor.hpp>
+
+// client packets are small, replies carry many packets of the round
+static constexpr size_t clientPacketsCount = 20'000;
+static constexpr size_t maxClientPacketSize = 8;
+static constexpr size_t repliesCount = 500;
+static constexpr size_t replySize = 100;
+
+static std::vector<Packet> packets;
+
+static csdb::Address randomAddress() {
+    if (cs::Random::generateValue<int>(0, 1)) {
+        return csdb::Address::from_wallet_id(cs::Random::generateValue<csdb::internal::WalletId>(1, 1'000'000));
+    }
+
+    cs::PublicKey key;
+
+    for (auto& byte : key) {
+        byte = cs::Random::generateValue<cs::Byte>(0, 255);
+    }
+
+    return csdb::Address::from_public_key(key);
+}
+
+static csdb::Transaction randomTransaction() {
+    cs::Signature signature;
+
+    for (auto& byte : signature) {
+        byte = cs::Random::generateValue<cs::Byte>(0, 255);
+    }
+
+    csdb::Transaction transaction;
+    transaction.set_innerID(cs::Random::generateValue<int64_t>(1, 1'000'000));
+    transaction.set_source(randomAddress());
+    transaction.set_target(randomAddress());
+    transaction.set_currency(csdb::Currency(1));
+    transaction.set_amount(csdb::Amount(cs::Random::generateValue<int32_t>(0, 10'000), cs::Random::generateValue<uint64_t>(0, 99), 100));
+    transaction.set_max_fee(csdb::AmountCommission(0.1));
+    transaction.set_counted_fee(csdb::AmountCommission(0.0087));
+    transaction.set_signature(signature);
+
+    return transaction;
+}
+
+static void addPacket(MsgTypes type, size_t transactionsCount) {
+    cs::TransactionsPacket transactionsPacket;
+
+    for (size_t i = 0; i < transactionsCount; ++i) {
+        transactionsPacket.addTransaction(randomTransaction());
+    }
+
+    cs::Bytes bytes(static_cast<size_t>(Offsets::HeaderLength));
+    bytes[0] = BaseFlags::Compressed;
+    bytes[1] = type;
+
+    const auto payload = transactionsPacket.toBinary();
+    bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+    packets.emplace_back(std::move(bytes));
+}
+
+static void testMethod(const char* name, PacketCompressor& compressor, PacketCompressor::Method method) {
+    cs::Console::writeLine("Test ", name);
+
+    std::vector<Packet> packed;
+    packed.reserve(packets.size());
+
+    // packets which are not smaller are sent as is
+    size_t bytes = 0;
+    size_t sentBytes = 0;
+
+    cs::Framework::execute([&] {
+        for (const auto& packet : packets) {
+            packed.push_back(packet);
+            compressor.pack(packed.back(), method);
+
+            bytes += packet.size();
+            sentBytes += packed.back().size();
+        }
+
+        for (auto& packet : packed) {
+            compressor.unpack(packet);
+        }
+    });
+
+    for (auto type : {MsgTypes::TransactionPacket, MsgTypes::TransactionsPacketReply}) {
+        const auto metrics = compressor.getMetrics(type);
+        const uint64_t count = metrics.packed ? metrics.packed : 1;
+
+        cs::Console::writeLine(Packet::messageTypeToString(type), ": packed ", metrics.packed, ", ratio ", metrics.ratio(),
+                               ", pack ", metrics.packTimeNs / count, " ns, unpack ", metrics.unpackTimeNs / count, " ns per message");
+    }
+
+    cs::Console::writeLine("Sent ", sentBytes, " of ", bytes, " bytes");
+
+    cs::Console::writeLine();
+}
+
+int main() {
+    for (size_t i = 0; i < clientPacketsCount; ++i) {
+        addPacket(MsgTypes::TransactionPacket, cs::Random::generateValue<size_t>(1, maxClientPacketSize));
+    }
+
+    for (size_t i = 0; i < repliesCount; ++i) {
+        addPacket(MsgTypes::TransactionsPacketReply, replySize);
+    }
+
+    PacketCompressor compressor;
+    testMethod("lz4", compressor, PacketCompressor::Method::Lz4);
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include <framework.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#include <csdb/address.hpp>
+#include <csdb/amount.hpp>
+#include <csdb/amount_commission.hpp>
+#include <csdb/currency.hpp>
+#include <csdb/transaction.hpp>
+
+#include <csnode/transactionsgraph.hpp>
+
+#include <lib/system/console.hpp>
+
+using Graph = cs::TransactionsGraph;
+using Wallet = Graph::Node;
+
+// group is a hub wallet paid by senders, hub pays back by many small transactions,
+// each rejected payment makes hub negative and its transactions are rescanned
+static constexpr size_t sendersCount = 64;
+static constexpr size_t hubTransactionsCount = 1024;
+static constexpr size_t groupSize = sendersCount + 1;
+static constexpr size_t groupsCount = 92;
+
+static const csdb::Amount zeroBalance = 0.0_c;
+
+struct Round {
+    std::vector<Wallet> nodes;
+    Graph::TrxList trxList;
+    std::vector<size_t> negativeNodes;
+};
+
+static std::vector<csdb::Transaction> transactions;
+static std::unordered_map<csdb::Address, size_t> walletIds;
+static Round origin;
+
+static csdb::Address walletAddress(size_t group, size_t index) {
+    return csdb::Address::from_wallet_id(static_cast<csdb::internal::WalletId>(group * groupSize + index + 1));
+}
+
+static void addTransaction(const csdb::Address& source, const csdb::Address& target, csdb::Amount amount) {
+    csdb::Transaction transaction;
+    transaction.set_innerID(static_cast<int64_t>(transactions.size() + 1));
+    transaction.set_source(source);
+    transaction.set_target(target);
+    transaction.set_currency(csdb::Currency(1));
+    transaction.set_amount(amount);
+    transaction.set_max_fee(csdb::AmountCommission(0.1));
+    transaction.set_counted_fee(csdb::AmountCommission(0.001));
+
+    transactions.push_back(transaction);
+}
+
+static void createRound() {
+    for (size_t group = 0; group < groupsCount; ++group) {
+        for (size_t index = 0; index < groupSize; ++index) {
+            walletIds.emplace(walletAddress(group, index), walletIds.size());
+        }
+    }
+
+    // hub spends before it is paid and senders have no funds, so rejects cascade from senders to hub and back
+    for (size_t group = 0; group < groupsCount; ++group) {
+        for (size_t i = 0; i < hubTransactionsCount; ++i) {
+            addTransaction(walletAddress(group, 0), walletAddress(group, 1 + i % sendersCount), csdb::Amount(0, 62, 100));
+        }
+
+        for (size_t index = 1; index <= sendersCount; ++index) {
+            addTransaction(walletAddress(group, index), walletAddress(group, 0), csdb::Amount(10));
+        }
+    }
+
+    origin.nodes.resize(walletIds.size());
+    origin.trxList.resize(transactions.size(), cs::WalletsState::noInd_);
+
+    for (size_t i = 0; i < origin.nodes.size(); ++i) {
+        origin.nodes[i].lastTrxInd_ = cs::WalletsState::noInd_;
+        // every fourth sender can not pay the hub
+        origin.nodes[i].balance_ = (i % groupSize) % 4 == 1 ? zeroBalance : csdb::Amount(1);
+    }
+
+    // the same way validator applies transactions of the round
+    for (size_t trxInd = 0; trxInd < transactions.size(); ++trxInd) {
+        const auto& transaction = transactions[trxInd];
+        const size_t sourceId = walletIds[transaction.source()];
+        Wallet& source = origin.nodes[sourceId];
+        Wallet& target = origin.nodes[walletIds[transaction.target()]];
+
+        source.balance_ = source.balance_ - transaction.amount() - csdb::Amount(transaction.counted_fee().to_double());
+        target.balance_ = target.balance_ + transaction.amount();
+
+        if (source.balance_ < zeroBalance) {
+            origin.negativeNodes.push_back(sourceId);
+        }
+
+        origin.trxList[trxInd] = source.lastTrxInd_;
+        source.lastTrxInd_ = static_cast<Graph::TransactionIndex>(trxInd);
+    }
+}
+
+static Graph::Stack negativeNodes(Round& round) {
+    Graph::Stack stack;
+
+    for (auto id : round.negativeNodes) {
+        stack.push_back(&round.nodes[id]);
+    }
+
+    return stack;
+}
+
+static size_t resolveByGraph(Round& round, cs::Bytes& mask) {
+    Graph graph(transactions, round.trxList, mask);
+    auto stack = negativeNodes(round);
+
+    return graph.resolve(stack, [&](const csdb::Address& target) {
+        return Graph::Target{&round.nodes[walletIds[target]], false};
+    });
+}
+
+// previous implementation, wallet lookup and cost are computed on each scan of the wallet transactions
+static size_t resolveByRescan(Round& round, cs::Bytes& mask) {
+    auto stack = negativeNodes(round);
+    size_t removed = 0;
+
+    auto cost = [](const csdb::Transaction& trx) {
+        csdb::Amount trxCost = trx.amount().to_double();
+        trxCost += csdb::Amount(trx.counted_fee().to_double());
+        return trxCost;
+    };
+
+    auto remove = [&](Wallet& node, Graph::TransactionIndex* prevNext, Graph::TransactionIndex trxInd) -> Wallet& {
+        const auto& trx = transactions[trxInd];
+        Wallet& destNode = round.nodes[walletIds[trx.target()]];
+
+        mask[trxInd] = Reject::Reason::NegativeResult;
+        node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.counted_fee().to_double());
+        destNode.balance_ = destNode.balance_ - trx.amount();
+
+        *prevNext = round.trxList[trxInd];
+        round.trxList[trxInd] = cs::WalletsState::noInd_;
+        ++removed;
+
+        return destNode;
+    };
+
+    // Positive and Negative passes of validator, the first one removes single transaction
+    auto pass = [&](Wallet& node, bool positive, bool single) {
+        if (node.balance_ >= zeroBalance) {
+            return true;
+        }
+
+        const csdb::Amount absBalance = -node.balance_;
+        Graph::TransactionIndex* prevNext = &node.lastTrxInd_;
+
+        for (auto trxInd = *prevNext; trxInd != cs::WalletsState::noInd_; trxInd = *prevNext) {
+            const auto& trx = transactions[trxInd];
+
+            if ((single && cost(trx) < absBalance) || (positive && trx.amount() > round.nodes[walletIds[trx.target()]].balance_)) {
+                prevNext = &round.trxList[trxInd];
+                continue;
+            }
+
+            Wallet& destNode = remove(node, prevNext, trxInd);
+
+            if (!positive && destNode.balance_ < zeroBalance) {
+                stack.push_back(&destNode);
+            }
+
+            if (single || node.balance_ >= zeroBalance) {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    while (!stack.empty()) {
+        Wallet& node = *stack.back();
+        stack.pop_back();
+
+        if (node.balance_ >= zeroBalance) {
+            continue;
+        }
+
+        pass(node, true, true) || pass(node, true, false) || pass(node, false, true) || pass(node, false, false);
+    }
+
+    return removed;
+}
+
+template <typename Func>
+static cs::Bytes testResolve(const char* name, Func func) {
+    cs::Console::writeLine("Test ", name);
+
+    Round round = origin;
+    cs::Bytes mask(transactions.size(), Reject::Reason::None);
+    size_t removed = 0;
+
+    cs::Framework::execute([&] { removed = func(round, mask); });
+    cs::Console::writeLine("Removed ", removed, " of ", transactions.size(), " transactions\n");
+
+    return mask;
+}
+
+int main() {
+    createRound();
+
+    cs::Console::writeLine("Round of ", transactions.size(), " transactions, ", origin.nodes.size(), " wallets, ",
+                           origin.negativeNodes.size(), " negative on apply\n");
+
+    const auto rescanMask = testResolve("rescan", resolveByRescan);
+    const auto graphMask = testResolve("graph", resolveByGraph);
+
+    cs::Console::writeLine(rescanMask == graphMask ? "Results are equal" : "Results differ");
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <framework.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include <lib/system/common.hpp>
+#include <lib/system/flathashmap.hpp>
+#include <lib/system/random.hpp>
+
+// counts heap usage of tested containers
+static std::atomic<size_t> allocatedBytes = 0;
+static std::atomic<size_t> allocationsCount = 0;
+
+void* operator new(size_t size) {
+    allocatedBytes += size;
+    ++allocationsCount;
+
+    if (void* ptr = std::malloc(size + sizeof(size_t)); ptr) {
+        *static_cast<size_t*>(ptr) = size;
+        return static_cast<size_t*>(ptr) + 1;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr) {
+        size_t* origin = static_cast<size_t*>(ptr) - 1;
+        allocatedBytes -= *origin;
+        std::free(origin);
+    }
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+struct Value {
+    uint64_t balance = 0;
+    uint64_t counter = 0;
+};
+
+static constexpr size_t keysCount = 1'000'000;
+static constexpr size_t lookupsCount = 10'000'000;
+
+static std::vector<cs::Hash> keys;
+static volatile uint64_t result = 0;
+
+template <typename Map>
+static void insertKeys(Map& map) {
+    for (const auto& key : keys) {
+        map[key].counter = 1;
+    }
+}
+
+template <typename Map>
+static void lookupKeys(const Map& map) {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookupsCount; ++i) {
+        auto iterator = map.find(keys[(i * 7919) % keys.size()]);
+
+        if (iterator != map.end()) {
+            sum += iterator->second.counter;
+        }
+    }
+
+    result = sum;
+}
+
+template <typename Map>
+static void testMap(const char* name) {
+    cs::Console::writeLine("Test ", name);
+
+    const size_t bytesBefore = allocatedBytes;
+    const size_t allocationsBefore = allocationsCount;
+
+    {
+        Map map;
+
+        cs::Console::writeLine("Insert ", keys.size(), " keys");
+        cs::Framework::execute([&] { insertKeys(map); });
+
+        cs::Console::writeLine("Heap bytes: ", allocatedBytes - bytesBefore, ", allocations: ", allocationsCount - allocationsBefore);
+
+        cs::Console::writeLine("Find ", lookupsCount, " keys");
+        cs::Framework::execute([&] { lookupKeys(map); });
+    }
+
+    cs::Console::writeLine("");
+}
+
+int main() {
+    keys.resize(keysCount);
+
+    for (auto& key : keys) {
+        for (auto& byte : key) {
+            byte = cs::Random::generateValue<cs::Byte>(0, 255);
+        }
+    }
+
+    testMap<std::map<cs::Hash, Value>>("std::map");
+    testMap<std::unordered_map<cs::Hash, Value>>("std::unordered_map");
+    testMap<cs::FlatHashMap<cs::Hash, Value>>("cs::FlatHashMap");
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <framework.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <vector>
+
+#include <csnode/odatastream.hpp>
+
+#include <lib/system/console.hpp>
+#include <lib/system/random.hpp>
+
+#include <net/packet.hpp>
+
+// counts heap allocations of send paths
+static std::atomic<size_t> allocationsCount = 0;
+
+void* operator new(size_t size) {
+    ++allocationsCount;
+
+    if (void* ptr = std::malloc(size); ptr) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+static constexpr size_t receiversCount = 32;
+static constexpr size_t broadcastsCount = 10'000;
+static constexpr size_t messageSize = 4096;
+
+static cs::Bytes message;
+static cs::Signature signature;
+static std::vector<cs::PublicKey> receivers(receiversCount);
+
+// bytes written by serialization or copy of each send path
+static size_t bytesWritten = 0;
+
+// host layer takes ownership of sent data
+struct Host {
+    void send(const cs::PublicKey&, cs::Bytes&& data) {
+        sent += data.size();
+        cs::Bytes drop(std::move(data));
+    }
+
+    size_t sent = 0;
+};
+
+static Host host;
+
+// the same way Node forms packets
+static Packet formPacket() {
+    cs::Bytes packetBytes;
+    cs::ODataStream stream(packetBytes);
+    stream << BaseFlags::Compressed;
+    stream << MsgTypes::FirstStage;
+    stream << cs::RoundNumber(1);
+    stream << message << signature;
+
+    bytesWritten += packetBytes.size();
+    return Packet(std::move(packetBytes));
+}
+
+static cs::Bytes copyData(const Packet& pack) {
+    bytesWritten += pack.size();
+
+    auto ptr = reinterpret_cast<const uint8_t*>(pack.data());
+    return cs::Bytes(ptr, ptr + pack.size());
+}
+
+// previous sendBroadcastIfNoConnection to list, packet is formed for each receiver
+static void serializePerReceiver() {
+    for (const auto& receiver : receivers) {
+        host.send(receiver, formPacket().moveData());
+    }
+}
+
+// previous sendMulticast, packet is formed once and copied for each receiver
+static void copyPerReceiver() {
+    Packet pack = formPacket();
+
+    for (const auto& receiver : receivers) {
+        host.send(receiver, copyData(pack));
+    }
+}
+
+// packet is formed once, the last receiver takes it without copy
+static void sharePacket() {
+    Packet pack = formPacket();
+
+    for (auto it = receivers.begin(); it != std::prev(receivers.end()); ++it) {
+        host.send(*it, copyData(pack));
+    }
+
+    host.send(receivers.back(), pack.moveData());
+}
+
+template <typename Func>
+static void testSend(const char* name, Func func) {
+    cs::Console::writeLine("Test ", name);
+
+    bytesWritten = 0;
+    const size_t allocationsBefore = allocationsCount;
+
+    cs::Framework::execute([&] {
+        for (size_t i = 0; i < broadcastsCount; ++i) {
+            func();
+        }
+    });
+
+    cs::Console::writeLine("Per broadcast: bytes written ", bytesWritten / broadcastsCount, ", heap allocations ", (allocationsCount - allocationsBefore) / broadcastsCount, "\n");
+}
+
+int main() {
+    message.resize(messageSize);
+
+    for (auto& byte : message) {
+        byte = cs::Random::generateValue<cs::Byte>(0, 255);
+    }
+
+    cs::Console::writeLine("Send ", broadcastsCount, " messages of ", messageSize, " bytes to ", receiversCount, " receivers\n");
+
+    testSend("serialize per receiver", serializePerReceiver);
+    testSend("copy per receiver", copyPerReceiver);
+    testSend("shared packet", sharePacket);
+
+    return 0;
+}
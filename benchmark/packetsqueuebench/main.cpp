@@ -0,0 +1,144 @@
+#include <framework.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <net/packetsqueue.hpp>
+
+#include <lib/system/console.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t producersCount = 4;
+static constexpr size_t packetsPerProducer = 250'000;
+static constexpr size_t packetSize = 128;
+
+// previous PacketsQueue, lists of both priorities are guarded by transport mutex
+class ListQueue {
+public:
+    using SenderAndPacket = PacketsQueue::SenderAndPacket;
+
+    bool push(const cs::PublicKey& sender, Packet&& pack) {
+        std::lock_guard lock(mutex_);
+
+        if (pack.getType() == MsgTypes::TransactionPacket) {
+            firstPriorityQ_.push_back({sender, std::move(pack)});
+        }
+        else {
+            secondPriorityQ_.push_back({sender, std::move(pack)});
+        }
+
+        return true;
+    }
+
+    bool pop(SenderAndPacket& result) {
+        std::lock_guard lock(mutex_);
+        auto& queue = !firstPriorityQ_.empty() ? firstPriorityQ_ : secondPriorityQ_;
+
+        if (queue.empty()) {
+            return false;
+        }
+
+        result = std::move(queue.front());
+        queue.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::list<SenderAndPacket> firstPriorityQ_;
+    std::list<SenderAndPacket> secondPriorityQ_;
+};
+
+// every fourth packet is of second priority, push time is stored after header
+static Packet createPacket(size_t index) {
+    cs::Bytes data(packetSize, 0);
+    data[static_cast<size_t>(Offsets::MsgTypes)] = index % 4 ? MsgTypes::TransactionPacket : MsgTypes::BlockRequest;
+
+    const auto ticks = Clock::now().time_since_epoch().count();
+    std::memcpy(data.data() + static_cast<size_t>(Offsets::HeaderLength), &ticks, sizeof(ticks));
+
+    return Packet(std::move(data));
+}
+
+static Clock::rep pushTime(const Packet& pack) {
+    Clock::rep ticks;
+    std::memcpy(&ticks, pack.getMsgData(), sizeof(ticks));
+    return ticks;
+}
+
+// producers retry a dropped packet, so every packet is delivered
+template <typename Queue>
+static void testQueue(const char* name) {
+    cs::Console::writeLine("Test ", name);
+
+    Queue queue;
+    std::vector<Clock::rep> latencies;
+    latencies.reserve(producersCount * packetsPerProducer);
+
+    std::atomic<size_t> retries = 0;
+    Clock::duration elapsed{};
+
+    cs::Framework::execute([&] {
+        const auto start = Clock::now();
+        std::vector<std::thread> producers;
+
+        for (size_t i = 0; i < producersCount; ++i) {
+            producers.emplace_back([&] {
+                cs::PublicKey sender{};
+
+                for (size_t index = 0; index < packetsPerProducer; ++index) {
+                    while (!queue.push(sender, createPacket(index))) {
+                        ++retries;
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        typename Queue::SenderAndPacket senderAndPack;
+
+        while (latencies.size() < producersCount * packetsPerProducer) {
+            if (!queue.pop(senderAndPack)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            latencies.push_back(Clock::now().time_since_epoch().count() - pushTime(senderAndPack.second));
+        }
+
+        elapsed = Clock::now() - start;
+
+        for (auto& producer : producers) {
+            producer.join();
+        }
+    });
+
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&](double value) {
+        const auto index = static_cast<size_t>(value * static_cast<double>(latencies.size() - 1));
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::duration(latencies[index])).count();
+    };
+
+    const auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+
+    cs::Console::writeLine("Packets per second: ", latencies.size() * 1'000'000 / static_cast<size_t>(std::max<decltype(elapsedUs)>(elapsedUs, 1)));
+    cs::Console::writeLine("Latency us p50: ", percentile(0.5), ", p99: ", percentile(0.99), ", p99.9: ", percentile(0.999), ", max: ", percentile(1.0));
+    cs::Console::writeLine("Retries on full queue: ", retries.load(), "\n");
+}
+
+int main() {
+    cs::Console::writeLine(producersCount, " producers push ", packetsPerProducer, " packets each\n");
+
+    testQueue<ListQueue>("list queue under mutex");
+    testQueue<PacketsQueue>("ring buffers");
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <framework.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <cscrypto/cscrypto.hpp>
+
+#include <csnode/nodeutils.hpp>
+#include <csnode/roundpackage.hpp>
+#include <csnode/transactionspacket.hpp>
+
+#include <lib/system/console.hpp>
+
+static constexpr size_t confidantsCount = 25;
+static constexpr size_t hashesCount = 100;
+static constexpr size_t packagesCount = 200;
+
+struct Confidant {
+    cs::PublicKey publicKey;
+    cscrypto::PrivateKey privateKey;
+};
+
+static std::vector<Confidant> confidants;
+static cs::ConfidantsKeys confidantsKeys;
+static cs::Bytes trustedMask;
+
+// each mode verifies its own packages, so memoized signatures of the other mode are not hit
+static std::vector<cs::Bytes> separatePackages;
+static std::vector<cs::Bytes> batchedPackages;
+static cs::RoundNumber firstRound = 100;
+
+static volatile size_t result = 0;
+
+static void createConfidants() {
+    cscrypto::cryptoInit();
+
+    for (size_t i = 0; i < confidantsCount; ++i) {
+        Confidant confidant;
+        confidant.privateKey = cscrypto::generateKeyPair(confidant.publicKey);
+
+        confidantsKeys.push_back(confidant.publicKey);
+        trustedMask.push_back(static_cast<cs::Byte>(i));
+        confidants.push_back(std::move(confidant));
+    }
+}
+
+static cs::Bytes createPackage(cs::RoundNumber round) {
+    cs::RoundTable table;
+    table.round = round;
+    table.confidants = confidantsKeys;
+
+    for (size_t i = 0; i < hashesCount; ++i) {
+        table.hashes.push_back(cs::TransactionsPacketHash::fromBinary(cs::Bytes(cscrypto::kHashSize, static_cast<cs::Byte>(i))));
+    }
+
+    cs::PoolMetaInfo meta;
+    meta.sequenceNumber = round - 1;
+    meta.timestamp = std::to_string(round);
+    meta.realTrustedMask = trustedMask;
+
+    cs::RoundPackage package;
+    package.updateRoundTable(table);
+    package.updatePoolMeta(meta);
+
+    const auto roundHash = package.hashToSign();
+    const auto tableHash = package.roundTableHash();
+
+    cs::Signatures roundSignatures;
+    cs::Signatures trustedSignatures;
+
+    for (const auto& confidant : confidants) {
+        roundSignatures.push_back(cscrypto::generateSignature(confidant.privateKey, roundHash.data(), roundHash.size()));
+        trustedSignatures.push_back(cscrypto::generateSignature(confidant.privateKey, tableHash.data(), tableHash.size()));
+    }
+
+    package.updateRoundSignatures(roundSignatures);
+    package.updatePoolSignatures(roundSignatures);
+    package.updateTrustedSignatures(trustedSignatures);
+
+    return package.toBinary();
+}
+
+static void createPackages() {
+    for (size_t i = 0; i < packagesCount; ++i) {
+        separatePackages.push_back(createPackage(firstRound + static_cast<cs::RoundNumber>(i)));
+        batchedPackages.push_back(createPackage(firstRound + static_cast<cs::RoundNumber>(packagesCount + i)));
+    }
+}
+
+// previous flow: bytes to sign and round table are rebuilt, signature sets are checked one after another
+static void verifySeparately() {
+    size_t valid = 0;
+
+    for (size_t i = 0; i < packagesCount; ++i) {
+        cs::RoundPackage package;
+        package.fromBinary(separatePackages[i], firstRound + static_cast<cs::RoundNumber>(i), 0);
+
+        const cs::Bytes roundBytes = package.bytesToSign();
+        const cs::Hash roundHash = cscrypto::calculateHash(roundBytes.data(), roundBytes.size());
+        bool ok = cs::NodeUtils::checkGroupSignature(confidantsKeys, trustedMask, package.roundSignatures(), roundHash);
+
+        const cs::Bytes tableBytes = package.roundTable().toBinary();
+        const cs::Hash tableHash = cscrypto::calculateHash(tableBytes.data(), tableBytes.size());
+        ok = ok && cs::NodeUtils::checkGroupSignature(confidantsKeys, trustedMask, package.trustedSignatures(), tableHash);
+
+        valid += ok;
+    }
+
+    result = valid;
+}
+
+static void verifyBatched() {
+    size_t valid = 0;
+
+    for (size_t i = 0; i < packagesCount; ++i) {
+        cs::RoundPackage package;
+        package.fromBinary(batchedPackages[i], firstRound + static_cast<cs::RoundNumber>(packagesCount + i), 0);
+
+        const std::vector<cs::NodeUtils::GroupSignature> groups = {
+            {&package.roundSignatures(), package.hashToSign()},
+            {&package.trustedSignatures(), package.roundTableHash()}
+        };
+
+        valid += cs::NodeUtils::checkGroupSignatures(confidantsKeys, trustedMask, groups);
+    }
+
+    result = valid;
+}
+
+template <typename Func>
+static void measure(const char* name, Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    cs::Framework::execute(func, std::chrono::seconds(120));
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    cs::Console::writeLine(name, ": ", us / static_cast<long long>(packagesCount), " us per round package, valid ", result);
+}
+
+int main() {
+    createConfidants();
+    createPackages();
+
+    cs::Console::writeLine(packagesCount, " round packages of ", confidantsCount, " confidants and ", hashesCount, " hashes");
+
+    measure("Signature sets one by one, bytes rebuilt", verifySeparately);
+    measure("Signature sets in one batch, bytes cached", verifyBatched);
+
+    return 0;
+}
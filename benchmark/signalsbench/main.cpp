@@ -1,5 +1,12 @@
 #include <framework.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <lib/system/signals.hpp>
 #include <lib/system/random.hpp>
 #include <lib/system/console.hpp>
@@ -45,6 +52,30 @@ static C* d = new D();
 static const size_t callsCount = 100'000'000;
 static const std::function<void()> bindedFunction = std::bind(&B::onCalled, &b);
 
+// emit throughput
+static const size_t emitsCount = 10'000'000;
+static const size_t slotsCount = 4;
+static const size_t emittersCount = 4;
+
+static cs::Signal<void(size_t)> counted;
+static cs::Signal<void(size_t)> single;
+static std::atomic<bool> isEmitting = false;
+
+class E {
+public slots:
+    void onCounted(size_t value) {
+        result = value;
+    }
+};
+
+static E e[slotsCount];
+static E* volatile target = &e[0];
+
+// slots array read by emission without reclamation guard, as before connections were allowed during emission
+using CountedSlots = cs::Signal<void(size_t)>::Slots;
+static const CountedSlots unguardedSlots{{nullptr, cs::cshelper::MethodSlotFor<E*, decltype(&E::onCounted)>{&e[0], &E::onCounted}}};
+static const CountedSlots* volatile unguarded = &unguardedSlots;
+
 static void runDirectCall() {
     for (size_t i = 0; i < callsCount; ++i) {
         b.onCalled();
@@ -75,6 +106,104 @@ static void runVirtualDerivedCall() {
     }
 }
 
+template <typename Func>
+static void measureEmits(const std::string& title, size_t emits, Func func) {
+    cs::Console::writeLine(title);
+
+    const auto start = std::chrono::steady_clock::now();
+    cs::Framework::execute(func);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    cs::Console::writeLine("Emits per second: ", emits * 1'000'000 / static_cast<size_t>(std::max<decltype(elapsedUs)>(elapsedUs, 1)), "\n");
+}
+
+static void emitCounted(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        counted(i);
+    }
+}
+
+template <typename Func>
+static void measureCallCost(const std::string& title, Func func) {
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < emitsCount; ++i) {
+        func(i);
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+    cs::Console::writeLine(title, ": ", static_cast<double>(elapsedNs) / emitsCount, " ns per call");
+}
+
+// emission publishes thread epoch around the slots call, the difference with unguarded loop is its cost
+static void testSingleSlotCost() {
+    cs::Connector::connect(&single, &e[0], &E::onCounted);
+
+    cs::Console::writeLine("Test single method slot emit against its baselines");
+    measureCallCost("Direct call", [](size_t value) { target->onCounted(value); });
+    measureCallCost("Unguarded slots loop", [](size_t value) {
+        for (const auto& slot : *unguarded) {
+            slot.delegate(value);
+        }
+    });
+    measureCallCost("Signal emit", [](size_t value) { single(value); });
+    cs::Console::writeLine("");
+
+    cs::Connector::disconnect(&single);
+}
+
+static void testEmitThroughput() {
+    for (auto& slot : e) {
+        cs::Connector::connect(&counted, &slot, &E::onCounted);
+    }
+
+    measureEmits("Test emit to " + std::to_string(slotsCount) + " method slots", emitsCount, [] {
+        emitCounted(emitsCount);
+    });
+
+    measureEmits("Test emit from " + std::to_string(emittersCount) + " threads", emitsCount, [] {
+        std::vector<std::thread> emitters;
+
+        for (size_t i = 0; i < emittersCount; ++i) {
+            emitters.emplace_back(&emitCounted, emitsCount / emittersCount);
+        }
+
+        for (auto& emitter : emitters) {
+            emitter.join();
+        }
+    });
+
+    measureEmits("Test emit while other thread connects and disconnects", emitsCount, [] {
+        isEmitting = true;
+
+        std::thread connector([] {
+            E extra;
+
+            while (isEmitting.load()) {
+                cs::Connector::connect(&counted, &extra, &E::onCounted);
+                cs::Connector::disconnect(&counted, &extra, &E::onCounted);
+            }
+        });
+
+        emitCounted(emitsCount);
+
+        isEmitting = false;
+        connector.join();
+    });
+
+    cs::Connector::disconnect(&counted);
+    cs::Connector::connect(&counted, [](size_t value) {
+        result = value;
+    });
+
+    measureEmits("Test emit to closure slot", emitsCount, [] {
+        emitCounted(emitsCount);
+    });
+}
+
 static void testDirectCall() {
     cs::Console::writeLine("Test direct method call");
     cs::Framework::execute(&runDirectCall);
@@ -113,6 +242,8 @@ int main() {
     testBindedFunction();
     testVirtualDirectCall();
     testVirtualDerivedCall();
+    testSingleSlotCost();
+    testEmitThroughput();
 
     delete c;
     delete d;
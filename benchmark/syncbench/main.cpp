@@ -0,0 +1,178 @@
+#include <framework.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <queue>
+#include <set>
+#include <vector>
+
+#include <csnode/syncscheduler.hpp>
+
+#include <lib/system/console.hpp>
+
+using Scheduler = cs::SyncScheduler;
+using TimePoint = Scheduler::TimePoint;
+using Duration = Scheduler::Duration;
+using namespace std::chrono_literals;
+
+static constexpr cs::Sequence targetSequence = 100'000;
+static constexpr size_t cachedBlocksLimit = 10'000;
+static constexpr Duration timerPeriod = 350ms;
+
+// loopback peer serves requests one by one
+struct Peer {
+    double blocksPerSecond;
+    Duration latency;
+    bool silent;
+
+    cs::PublicKey key{};
+    TimePoint busyUntil{};
+};
+
+struct Reply {
+    TimePoint time;
+    size_t peer;
+    cs::PoolsRequestedSequences sequences;
+
+    bool operator>(const Reply& other) const {
+        return time > other.time;
+    }
+};
+
+static std::vector<Peer> createPeers() {
+    std::vector<Peer> peers = {
+        {5000, 20ms, false},
+        {2000, 50ms, false},
+        {1000, 100ms, false},
+        {300, 150ms, false},
+        {50, 300ms, false},
+        {0, 0ms, true}
+    };
+
+    for (size_t i = 0; i < peers.size(); ++i) {
+        peers[i].key[0] = static_cast<cs::Byte>(i + 1);
+    }
+
+    return peers;
+}
+
+struct Result {
+    Duration syncTime{};
+    size_t requests = 0;
+    size_t timeouts = 0;
+};
+
+// required intervals are gaps between written and received blocks
+static std::vector<Scheduler::Interval> requiredIntervals(cs::Sequence lastWritten, const std::set<cs::Sequence>& received) {
+    std::vector<Scheduler::Interval> intervals;
+    cs::Sequence first = lastWritten + 1;
+
+    for (auto sequence : received) {
+        if (sequence > first) {
+            intervals.emplace_back(first, sequence - 1);
+        }
+
+        first = sequence + 1;
+    }
+
+    intervals.emplace_back(first, targetSequence);
+    return intervals;
+}
+
+static Result simulate(const Scheduler::Settings& settings) {
+    Scheduler scheduler(settings);
+    auto peers = createPeers();
+
+    for (const auto& peer : peers) {
+        scheduler.addNeighbour(peer.key, targetSequence);
+    }
+
+    std::priority_queue<Reply, std::vector<Reply>, std::greater<Reply>> replies;
+    std::set<cs::Sequence> received;
+    cs::Sequence lastWritten = 0;
+
+    const TimePoint start{};
+    TimePoint now = start;
+    TimePoint nextTick = start;
+    Result result;
+
+    while (lastWritten < targetSequence) {
+        if (!replies.empty() && replies.top().time <= nextTick) {
+            Reply reply = replies.top();
+            replies.pop();
+            now = reply.time;
+
+            scheduler.onReply(peers[reply.peer].key, reply.sequences, now);
+
+            for (auto sequence : reply.sequences) {
+                if (sequence > lastWritten) {
+                    received.insert(sequence);
+                    scheduler.onStored(sequence);
+                }
+            }
+
+            while (!received.empty() && *received.begin() == lastWritten + 1) {
+                received.erase(received.begin());
+                ++lastWritten;
+            }
+        }
+        else {
+            now = nextTick;
+            nextTick += timerPeriod;
+        }
+
+        const cs::Sequence limit = std::min<cs::Sequence>(lastWritten + cachedBlocksLimit, targetSequence);
+
+        for (auto& request : scheduler.schedule(requiredIntervals(lastWritten, received), limit, now)) {
+            ++result.requests;
+
+            const auto index = static_cast<size_t>(std::find_if(peers.begin(), peers.end(), [&](const Peer& peer) {
+                return peer.key == request.target;
+            }) - peers.begin());
+
+            Peer& peer = peers[index];
+
+            if (peer.silent) {
+                continue;
+            }
+
+            const auto serviceTime = std::chrono::duration_cast<Duration>(std::chrono::duration<double>(static_cast<double>(request.sequences.size()) / peer.blocksPerSecond));
+            peer.busyUntil = std::max(now + peer.latency, peer.busyUntil) + serviceTime;
+
+            replies.push(Reply{peer.busyUntil + peer.latency, index, std::move(request.sequences)});
+        }
+    }
+
+    result.syncTime = now - start;
+    result.timeouts = scheduler.timeoutsCount();
+
+    return result;
+}
+
+static void testScheduler(const char* name, const Scheduler::Settings& settings) {
+    cs::Console::writeLine("Test ", name);
+
+    Result result;
+    cs::Framework::execute([&] { result = simulate(settings); });
+
+    cs::Console::writeLine("Synced in ", std::chrono::duration_cast<std::chrono::milliseconds>(result.syncTime).count(), " ms of simulated time, ",
+                           result.requests, " requests, ", result.timeouts, " timeouts\n");
+}
+
+int main() {
+    cs::Console::writeLine("Sync ", targetSequence, " blocks from 5 peers of 5000 to 50 blocks/s and a silent one\n");
+
+    // previous synchronizer, fixed request of blockPoolsCount blocks and a long timeout
+    Scheduler::Settings fixed;
+    fixed.minRequestSize = 100;
+    fixed.maxRequestSize = 100;
+    fixed.initialRequestSize = 100;
+    fixed.maxRequestsInFlight = 1;
+    fixed.minTimeout = 10s;
+    fixed.maxTimeout = 10s;
+
+    testScheduler("fixed window", fixed);
+    testScheduler("adaptive pipeline", Scheduler::Settings{});
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <framework.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <csdb/address.hpp>
+#include <csdb/amount.hpp>
+#include <csdb/currency.hpp>
+#include <csdb/transaction.hpp>
+
+#include <cscrypto/cscrypto.hpp>
+
+#include <lib/system/console.hpp>
+
+static const size_t transactionsCount = 1000;
+static const size_t verificationsCount = 20;
+
+static cs::PublicKey publicKey;
+static std::vector<csdb::Transaction> transactions;
+static volatile size_t result = 0;
+
+static void createTransactions() {
+    cscrypto::cryptoInit();
+    auto privateKey = cscrypto::generateKeyPair(publicKey);
+
+    cs::PublicKey target;
+    cscrypto::generateKeyPair(target);
+
+    for (size_t i = 0; i < transactionsCount; ++i) {
+        csdb::Transaction transaction;
+        transaction.set_innerID(static_cast<int64_t>(i + 1));
+        transaction.set_source(csdb::Address::from_public_key(publicKey));
+        transaction.set_target(csdb::Address::from_public_key(target));
+        transaction.set_currency(1);
+        transaction.set_amount(csdb::Amount(static_cast<int32_t>(i), 0));
+        transaction.add_user_field(1, std::string(64, 'x'));
+
+        const auto bytes = transaction.to_byte_stream_for_sig();
+        transaction.set_signature(cscrypto::generateSignature(privateKey, bytes.data(), bytes.size()));
+
+        transactions.push_back(transaction);
+    }
+}
+
+// clone does not share cached forms, so each verification rebuilds signing bytes as before memoization
+static void verifyUncached() {
+    size_t valid = 0;
+
+    for (size_t i = 0; i < verificationsCount; ++i) {
+        for (const auto& transaction : transactions) {
+            valid += transaction.clone().verify_signature(publicKey);
+        }
+    }
+
+    result = valid;
+}
+
+static void cloneOnly() {
+    size_t count = 0;
+
+    for (size_t i = 0; i < verificationsCount; ++i) {
+        for (const auto& transaction : transactions) {
+            count += transaction.clone().is_valid();
+        }
+    }
+
+    result = count;
+}
+
+static void verifyCached() {
+    size_t valid = 0;
+
+    for (size_t i = 0; i < verificationsCount; ++i) {
+        for (const auto& transaction : transactions) {
+            valid += transaction.verify_signature(publicKey);
+        }
+    }
+
+    result = valid;
+}
+
+static void serializeUncached() {
+    size_t size = 0;
+
+    for (size_t i = 0; i < verificationsCount * 100; ++i) {
+        for (const auto& transaction : transactions) {
+            size += transaction.clone().to_byte_stream_for_sig().size();
+        }
+    }
+
+    result = size;
+}
+
+static void serializeCached() {
+    size_t size = 0;
+
+    for (size_t i = 0; i < verificationsCount * 100; ++i) {
+        for (const auto& transaction : transactions) {
+            size += transaction.signing_bytes()->size();
+        }
+    }
+
+    result = size;
+}
+
+template <typename Func>
+static void measure(const char* name, size_t operations, Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    cs::Framework::execute(func, std::chrono::seconds(120));
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    cs::Console::writeLine(name, ": ", static_cast<size_t>(operations / seconds), " per second");
+}
+
+int main() {
+    createTransactions();
+
+    const size_t verifications = transactionsCount * verificationsCount;
+    const size_t serializations = verifications * 100;
+
+    measure("Clone only", verifications, cloneOnly);
+    measure("Verify, signing bytes rebuilt", verifications, verifyUncached);
+    measure("Verify, signing bytes cached", verifications, verifyCached);
+    measure("Signing bytes rebuilt", serializations, serializeUncached);
+    measure("Signing bytes cached", serializations, serializeCached);
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <framework.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <vector>
+
+#include <csdb/address.hpp>
+#include <csdb/amount.hpp>
+
+#include <csnode/walletscache.hpp>
+#include <csnode/walletsids.hpp>
+#include <csnode/walletsstate.hpp>
+
+#include <lib/system/console.hpp>
+#include <lib/system/flathashmap.hpp>
+#include <lib/system/random.hpp>
+
+// counts heap allocations of tested states
+static std::atomic<size_t> allocationsCount = 0;
+
+void* operator new(size_t size) {
+    ++allocationsCount;
+
+    if (void* ptr = std::malloc(size); ptr) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+static constexpr size_t walletsCount = 200'000;
+static constexpr size_t transactionsCount = 100'000;
+static constexpr size_t roundsCount = 20;
+
+// previous WalletsState, wallet copies with delegations are stored in map cleared every round
+class CopyingState {
+public:
+    struct WalletData {
+        cs::WalletsState::TransactionIndex lastTrxInd_{};
+        csdb::Amount balance_{};
+        csdb::Amount delegated_{};
+        std::map<cs::PublicKey, std::vector<cs::TimeMoney>> delegateSources_{};
+        std::map<cs::PublicKey, std::vector<cs::TimeMoney>> delegateTargets_{};
+        cs::TransactionsTail trxTail_{};
+    };
+
+    explicit CopyingState(const cs::WalletsCache::Updater& cacheUpd) : wallCache_(cacheUpd) {}
+
+    WalletData& getData(const csdb::Address& address) {
+        auto pubKey = wallCache_.toPublicKey(address);
+        auto it = storage_.find(pubKey);
+
+        if (it != storage_.end()) {
+            return it->second;
+        }
+
+        auto walletPtr = wallCache_.findWallet(address);
+
+        if (walletPtr) {
+            return storage_.insert(std::make_pair(pubKey, WalletData{cs::WalletsState::noInd_, walletPtr->balance_, walletPtr->delegated_,
+                                                                     walletPtr->delegateSources_ ? *walletPtr->delegateSources_ : std::map<cs::PublicKey, std::vector<cs::TimeMoney>>{},
+                                                                     walletPtr->delegateTargets_ ? *walletPtr->delegateTargets_ : std::map<cs::PublicKey, std::vector<cs::TimeMoney>>{},
+                                                                     walletPtr->trxTail_}))
+                .first->second;
+        }
+
+        return storage_.insert(std::make_pair(pubKey, WalletData{cs::WalletsState::noInd_})).first->second;
+    }
+
+    void updateFromSource() {
+        storage_.clear();
+    }
+
+private:
+    const cs::WalletsCache::Updater& wallCache_;
+    cs::FlatHashMap<cs::PublicKey, WalletData> storage_;
+};
+
+static std::vector<csdb::Address> addresses;
+static std::vector<std::pair<size_t, size_t>> transfers;
+static volatile size_t result = 0;
+
+// applies round transfers the same way stage one validation does
+template <typename State>
+static void validateRound(State& state) {
+    state.updateFromSource();
+
+    size_t negative = 0;
+
+    for (const auto& [source, target] : transfers) {
+        auto& sourceData = state.getData(addresses[source]);
+        sourceData.balance_ = sourceData.balance_ - csdb::Amount(1);
+        negative += sourceData.balance_ < csdb::Amount(0);
+
+        auto& targetData = state.getData(addresses[target]);
+        targetData.balance_ = targetData.balance_ + csdb::Amount(1);
+    }
+
+    result = negative;
+}
+
+template <typename State>
+static void testState(const char* name, const cs::WalletsCache::Updater& updater) {
+    cs::Console::writeLine("Test ", name);
+
+    State state(updater);
+    validateRound(state);
+
+    const size_t allocationsBefore = allocationsCount;
+
+    cs::Console::writeLine("Validate ", roundsCount, " rounds of ", transfers.size(), " transactions");
+    cs::Framework::execute([&] {
+        for (size_t i = 0; i < roundsCount; ++i) {
+            validateRound(state);
+        }
+    });
+
+    cs::Console::writeLine("Heap allocations per round: ", (allocationsCount - allocationsBefore) / roundsCount, "\n");
+}
+
+int main() {
+    addresses.reserve(walletsCount);
+
+    for (size_t i = 0; i < walletsCount; ++i) {
+        cs::PublicKey key;
+
+        for (auto& byte : key) {
+            byte = cs::Random::generateValue<cs::Byte>(0, 255);
+        }
+
+        addresses.push_back(csdb::Address::from_public_key(key));
+    }
+
+    for (size_t i = 0; i < transactionsCount; ++i) {
+        transfers.emplace_back(cs::Random::generateValue<size_t>(0, static_cast<int>(walletsCount - 1)), cs::Random::generateValue<size_t>(0, static_cast<int>(walletsCount - 1)));
+    }
+
+    cs::WalletsIds ids;
+    cs::WalletsCache cache(ids);
+    auto updater = cache.createUpdater();
+
+    testState<CopyingState>("copying state", *updater);
+    testState<cs::WalletsState>("arena overlay", *updater);
+
+    return 0;
+}
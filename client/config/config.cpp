@@ -53,6 +53,8 @@ const std::string PARAM_NAME_ALWAYS_EXECUTE_CONTRACTS = "always_execute_contract
 const std::string PARAM_NAME_MIN_COMPATIBLE_VERSION = "min_compatible_version";
 const std::string PARAM_NAME_COMPATIBLE_VERSION = "compatible_version";
 const std::string PARAM_NAME_TRAVERSE_NAT = "traverse_nat";
+const std::string PARAM_NAME_TRAFFIC_STATS_PERIOD = "traffic_stats_period";
+const std::string PARAM_NAME_DUPLICATES_FALSE_POSITIVE_RATE = "duplicates_false_positive_rate";
 
 const std::string PARAM_NAME_CONVEYER_MAX_PACKET_LIFETIME = "max_packet_life_time";
 
@@ -111,6 +113,7 @@ const std::string ARG_NAME_PUBLIC_KEY_FILE = "public-key-file";
 const std::string ARG_NAME_PRIVATE_KEY_FILE = "private-key-file";
 const std::string ARG_NAME_ENCRYPT_KEY_FILE = "encryptkey";
 const std::string ARG_NAME_RECREATE_INDEX = "recreate-index";
+const std::string ARG_NAME_DEEP_VALIDATION = "deep-validation";
 const std::string ARG_NAME_NEW_BC_TOP = "set-bc-top";
 const std::string ARG_NAME_DISABLE_AUTO_SHUTDOWN = "disable-auto-shutdown";
 
@@ -225,6 +228,7 @@ Config Config::read(po::variables_map& vm) {
     Config result = readFromFile(getArgFromCmdLine(vm, ARG_NAME_CONFIG_FILE, DEFAULT_PATH_TO_CONFIG));
 
     result.recreateIndex_ = vm.count(ARG_NAME_RECREATE_INDEX);
+    result.deepValidation_ = vm.count(ARG_NAME_DEEP_VALIDATION);
     result.autoShutdownEnabled_ = !vm.count(ARG_NAME_DISABLE_AUTO_SHUTDOWN);
     result.pathToDb_ = getArgFromCmdLine(vm, ARG_NAME_DB_PATH, DEFAULT_PATH_TO_DB);
 
@@ -766,6 +770,8 @@ Config Config::readFromFile(const std::string& fileName) {
         result.observerWaitTime_ = params.count(PARAM_NAME_OBSERVER_WAIT_TIME) ? params.get<uint64_t>(PARAM_NAME_OBSERVER_WAIT_TIME) : DEFAULT_OBSERVER_WAIT_TIME;
         result.roundElapseTime_ = params.count(PARAM_NAME_ROUND_ELAPSE_TIME) ? params.get<uint64_t>(PARAM_NAME_ROUND_ELAPSE_TIME) : DEFAULT_ROUND_ELAPSE_TIME;
         result.storeBlockElapseTime_ = params.count(PARAM_NAME_STORE_BLOCK_ELAPSE_TIME) ? params.get<uint64_t>(PARAM_NAME_STORE_BLOCK_ELAPSE_TIME) : DEFAULT_STORE_BLOCK_ELAPSE_TIME;
+        result.trafficStatsPeriod_ = params.count(PARAM_NAME_TRAFFIC_STATS_PERIOD) ? params.get<uint64_t>(PARAM_NAME_TRAFFIC_STATS_PERIOD) : 0;
+        result.duplicatesFalsePositiveRate_ = params.count(PARAM_NAME_DUPLICATES_FALSE_POSITIVE_RATE) ? params.get<double>(PARAM_NAME_DUPLICATES_FALSE_POSITIVE_RATE) : DEFAULT_DUPLICATES_FALSE_POSITIVE_RATE;
 
         if (config.count(BLOCK_NAME_HOST_ADDRESS)) {
             result.hostAddressEp_ = readEndpoint(config, BLOCK_NAME_HOST_ADDRESS);
@@ -1132,9 +1138,12 @@ bool operator==(const Config& lhs, const Config& rhs) {
         lhs.alwaysExecuteContracts_ == rhs.alwaysExecuteContracts_ &&
         lhs.compatibleVersion_ == rhs.compatibleVersion_ &&
         lhs.recreateIndex_ == rhs.recreateIndex_ &&
+        lhs.deepValidation_ == rhs.deepValidation_ &&
         lhs.observerWaitTime_ == rhs.observerWaitTime_ &&
         lhs.roundElapseTime_ == rhs.roundElapseTime_ &&
         lhs.storeBlockElapseTime_ == rhs.storeBlockElapseTime_ &&
+        lhs.trafficStatsPeriod_ == rhs.trafficStatsPeriod_ &&
+        lhs.duplicatesFalsePositiveRate_ == rhs.duplicatesFalsePositiveRate_ &&
         lhs.conveyerData_ == rhs.conveyerData_ &&
         lhs.minCompatibleVersion_ == rhs.minCompatibleVersion_ &&
         lhs.eventsReport_ == rhs.eventsReport_;
@@ -35,6 +35,8 @@ const uint32_t DEFAULT_STORE_BLOCK_ELAPSE_TIME = 1000 * 40; // ms
 
 const size_t DEFAULT_CONVEYER_MAX_PACKET_LIFETIME = 10; // rounds
 
+const double DEFAULT_DUPLICATES_FALSE_POSITIVE_RATE = 0.001;
+
 using Port = short unsigned;
 
 struct EndpointData {
@@ -220,6 +222,10 @@ public:
         return recreateIndex_;
     }
 
+    bool deepValidation() const {
+        return deepValidation_;
+    }
+
     bool autoShutdownEnabled() const {
         return autoShutdownEnabled_;
     }
@@ -274,6 +280,16 @@ public:
         return storeBlockElapseTime_;
     }
 
+    // seconds between traffic stats log dumps, zero disables them
+    uint64_t trafficStatsPeriod() const {
+        return trafficStatsPeriod_;
+    }
+
+    // share of new transaction packets taken for duplicates by transport, zero disables the filter
+    double duplicatesFalsePositiveRate() const {
+        return duplicatesFalsePositiveRate_;
+    }
+
     bool readKeys(const po::variables_map& vm);
     bool enterWithSeed();
 
@@ -350,6 +366,7 @@ private:
 
     bool alwaysExecuteContracts_ = false;
     bool recreateIndex_ = false;
+    bool deepValidation_ = false;
     bool newBlockchainTop_ = false;
     bool autoShutdownEnabled_ = true;
     bool compatibleVersion_ = true;
@@ -359,6 +376,8 @@ private:
     uint64_t observerWaitTime_ = DEFAULT_OBSERVER_WAIT_TIME;
     uint64_t roundElapseTime_ = DEFAULT_ROUND_ELAPSE_TIME;
     uint64_t storeBlockElapseTime_ = DEFAULT_STORE_BLOCK_ELAPSE_TIME;
+    uint64_t trafficStatsPeriod_ = 0;
+    double duplicatesFalsePositiveRate_ = DEFAULT_DUPLICATES_FALSE_POSITIVE_RATE;
 
     ConveyerData conveyerData_;
 
@@ -166,6 +166,7 @@ int main(int argc, char* argv[]) {
     desc.add_options()
         (argHelp, "produce this message")
         ("recreate-index", "recreate index.db")
+        ("deep-validation", "validate blocks read from DB on start, validated ones are skipped on the next start")
         (argSeed, "enter with seed instead of keys")
         (argSetBCTop, po::value<uint64_t>(), "all blocks in blockchain with higher sequence will be removed")
         ("disable-auto-shutdown", "node will be prohibited to shutdown in case of fatal errors")
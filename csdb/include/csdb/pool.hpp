@@ -243,6 +243,13 @@ public:
      */
     cs::Bytes to_binary() const noexcept;
 
+    /**
+     * @brief Бинарное представление пула без копирования
+     * @return То же, что и \ref to_binary, но по ссылке на данные пула. Представление,
+     *         сформированное \ref compose, сбрасывается при любом изменении пула.
+     */
+    const cs::Bytes& binary() const noexcept;
+
     /**
      * @brief Сохранение пула в хранилище.
      * @param[in] storage Хранилище, в котором нужно сохранить пул.
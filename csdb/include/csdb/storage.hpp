@@ -203,6 +203,12 @@ public:
     Pool pool_load(const cs::Sequence sequence) const;
     Pool pool_load_meta(const PoolHash& hash, size_t& cnt) const;
 
+    /**
+     * @brief Loads stored binary of pool without decoding it.
+     * @return false if pool of sequence is not found.
+     */
+    bool pool_load_binary(const cs::Sequence sequence, cs::Bytes& data) const;
+
     Pool pool_remove_last();
 
 	/**
@@ -6,6 +6,7 @@
 #ifndef _CREDITS_CSDB_TRANSACTION_H_INCLUDED_
 #define _CREDITS_CSDB_TRANSACTION_H_INCLUDED_
 
+#include <memory>
 #include <set>
 
 #include <csdb/user_field.hpp>
@@ -123,6 +124,11 @@ public:
     std::vector<uint8_t> to_byte_stream() const;
     std::vector<uint8_t> to_byte_stream_for_sig() const;
 
+    // serialized forms are built once and shared by copies until any setter is called
+    size_t byte_stream_size() const;
+    std::shared_ptr<const cs::Bytes> signing_bytes() const;
+    cs::Hash signing_hash() const;
+
     bool verify_signature(const cs::PublicKey& public_key) const;
 
     /**
@@ -157,6 +163,10 @@ public:
     uint64_t get_time() const;
 
 private:
+  std::shared_ptr<const cs::Bytes> binary() const;
+  cs::Bytes make_signing_bytes() const;
+  void put_fields(::csdb::priv::obstream&) const;
+
   void put(::csdb::priv::obstream&) const;
   bool get(::csdb::priv::ibstream&);
   friend class ::csdb::priv::obstream;
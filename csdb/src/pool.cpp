@@ -468,6 +468,22 @@ class Pool::priv : public ::csdb::internal::shared_data {
         binary_representation_ = std::move(bytes);
     }
 
+    // composed pool keeps the binary its hash was calculated from,
+    // any other mutation makes the cached binary and hash stale
+    void invalidate_binary() {
+        if (read_only_) {
+            return;
+        }
+
+        if (!binary_representation_.empty()) {
+            binary_representation_.clear();
+        }
+
+        if (!hash_.is_empty()) {
+            hash_ = PoolHash();
+        }
+    }
+
     void update_transactions() {
         read_only_ = true;
 
@@ -690,6 +706,7 @@ bool Pool::add_transaction(Transaction transaction
 
     d->transactions_.push_back(Transaction(new Transaction::priv(*(transaction.d.constData()))));
     ++d->transactionsCount_;
+    d->invalidate_binary();
     return true;
 }
 
@@ -751,6 +768,7 @@ void Pool::set_version(uint8_t version) noexcept {
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->version_ = version;
 }
 
@@ -761,6 +779,7 @@ void Pool::set_sequence(cs::Sequence seq) noexcept {
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->sequence_ = seq;
 }
 
@@ -771,6 +790,7 @@ void Pool::setRoundCost(const csdb::Amount& roundCost) noexcept {
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->roundCost_ = roundCost;
 }
 
@@ -781,6 +801,7 @@ void Pool::set_previous_hash(PoolHash previous_hash) noexcept {
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->previous_hash_ = std::move(previous_hash);
 }
 
@@ -791,6 +812,7 @@ void Pool::set_confidants(const std::vector<cs::PublicKey>& confidants) noexcept
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->confidants_ = confidants;
 }
 
@@ -802,42 +824,49 @@ void Pool::set_signatures(std::vector<cs::Signature>& blockSignatures) noexcept
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->signatures_ = std::move(blockSignatures);
 }
 
 void Pool::add_smart_signature(const csdb::Pool::SmartSignature& smartSignature) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->smartSignatures_.emplace_back(smartSignature);
 }
 
 void Pool::add_round_confirmations(const std::vector<cs::Signature>& confirmations) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->roundConfirmations_ = std::move(confirmations);
 }
 
 void Pool::add_real_trusted(const uint64_t trustedMask) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->realTrusted_ = trustedMask;
 }
 
 void Pool::add_confirmation_mask(const uint64_t confMask) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->roundConfirmationMask_ = confMask;
 }
 
 void Pool::add_number_trusted(const uint8_t trustedNumber) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->numberTrusted_ = trustedNumber;
 }
 
 void Pool::add_number_confirmations(const uint8_t confNumber) noexcept {
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->numberConfirmations_ = confNumber;
 }
 
@@ -860,6 +889,8 @@ Pool::NewWallets* Pool::newWallets() noexcept {
     if (d.constData()->read_only_) {
         return nullptr;
     }
+
+    d->invalidate_binary();
     return &d->newWallets_;
 }
 
@@ -874,6 +905,7 @@ bool Pool::add_user_field(user_field_id_t id, const UserField& field) noexcept {
 
     priv* data = d.data();
     data->is_valid_ = true;
+    data->invalidate_binary();
     data->user_fields_[id] = field;
 
     return true;
@@ -907,6 +939,10 @@ cs::Bytes Pool::to_binary() const noexcept {
     return d->binary_representation_;
 }
 
+const cs::Bytes& Pool::binary() const noexcept {
+    return d->binary_representation_;
+}
+
 /*static*/
 PoolHash Pool::hash_from_binary(cs::Bytes&& data) {
 	std::unique_ptr<priv> p{ new priv() };
@@ -317,7 +317,7 @@ void Storage::priv::write_routine() {
             }
             const PoolHash hash = pool.hash();
 
-            db->put(hash.to_binary(), static_cast<uint32_t>(pool.sequence()), pool.to_binary());
+            db->put(hash.to_binary(), static_cast<uint32_t>(pool.sequence()), pool.binary());
 
             write_queue.pop_front();
         }
@@ -522,7 +522,7 @@ bool Storage::pool_save(Pool pool) {
         d->write_cond_var.notify_one();
       }
     */
-    d->db->put(hash.to_binary(), static_cast<uint32_t>(pool.sequence()), pool.to_binary());
+    d->db->put(hash.to_binary(), static_cast<uint32_t>(pool.sequence()), pool.binary());
 
     {
         std::unique_lock<std::mutex> lock(d->data_lock);
@@ -696,6 +696,43 @@ Pool Storage::pool_load(const cs::Sequence sequence) const {
     return res;
 }
 
+bool Storage::pool_load_binary(const cs::Sequence sequence, cs::Bytes& data) const {
+    if (!isOpen()) {
+        d->set_last_error(NotOpen);
+        return false;
+    }
+
+    const auto &index = d->pools_cache.get<Storage::priv::PoolElement::bySequence>();
+    auto it = index.find(sequence);
+    if (it != index.end() && !(*it).pool.binary().empty()) {
+        data = (*it).pool.binary();
+        d->set_last_error();
+        return true;
+    }
+
+    if (!d->db->get(static_cast<uint32_t>(sequence), &data)) {
+        {
+            std::unique_lock<std::mutex> lock(d->write_lock);
+            for (auto& poolToWrite : d->write_queue) {
+                if (poolToWrite.sequence() == sequence && !poolToWrite.binary().empty()) {
+                    data = poolToWrite.binary();
+                    d->set_last_error();
+                    return true;
+                }
+            }
+        }
+
+        // writer thread may have moved block from queue to db between the checks
+        if (!d->db->get(static_cast<uint32_t>(sequence), &data)) {
+            d->set_last_error(DatabaseError);
+            return false;
+        }
+    }
+
+    d->set_last_error();
+    return true;
+}
+
 Pool Storage::pool_load_meta(const PoolHash& hash, size_t& cnt) const {
     if (!isOpen()) {
         d->set_last_error(NotOpen);
@@ -142,42 +142,49 @@ const cs::Signature& Transaction::signature() const noexcept {
 void Transaction::set_innerID(int64_t innerID) {
     if (!d.constData()->read_only_) {
         d->innerID_ = innerID;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_source(Address source) {
     if (!d.constData()->read_only_) {
         d->source_ = source;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_target(Address target) {
     if (!d.constData()->read_only_) {
         d->target_ = target;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_currency(Currency currency) {
     if (!d.constData()->read_only_) {
         d->currency_ = currency;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_amount(Amount amount) {
     if (!d.constData()->read_only_) {
         d->amount_ = amount;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_max_fee(AmountCommission max_fee) {
     if (!d.constData()->read_only_) {
         d->max_fee_ = max_fee;
+        d->reset_caches();
     }
 }
 
 void Transaction::set_counted_fee(AmountCommission counted_fee) {
     if (!d.constData()->read_only_) {
         d->counted_fee_ = counted_fee;
+        d->reset_binary_cache();
     }
 }
 
@@ -187,12 +194,14 @@ void Transaction::set_counted_fee_unsafe(AmountCommission counted_fee) {
         const priv* constPrivPtr = constPrivShared.data();
         priv* privPtr = const_cast<priv*>(constPrivPtr);
         privPtr->counted_fee_ = counted_fee;
+        privPtr->reset_binary_cache();
     }
 }
 
 void Transaction::set_signature(const cs::Signature& signature) {
     if (!d.constData()->read_only_) {
         d->signature_ = signature;
+        d->reset_caches();
     }
 }
 
@@ -201,6 +210,7 @@ bool Transaction::add_user_field(user_field_id_t id, UserField field) noexcept {
         return false;
     }
     d->user_fields_[id] = field;
+    d->reset_caches();
     return true;
 }
 
@@ -223,9 +233,7 @@ cs::Bytes Transaction::to_binary() {
     if (!is_valid()) {
         return cs::Bytes();
     }
-    ::csdb::priv::obstream os;
-    put(os);
-    return os.buffer();
+    return *binary();
 }
 
 Transaction Transaction::from_binary(const cs::Bytes& data) {
@@ -251,17 +259,62 @@ Transaction Transaction::from_byte_stream(const char* data, size_t m_size) {
 }
 
 std::vector<uint8_t> Transaction::to_byte_stream() const {
-    ::csdb::priv::obstream os;
-    put(os);
-    return os.buffer();
+    return *binary();
+}
+
+size_t Transaction::byte_stream_size() const {
+    return binary()->size();
 }
 
 bool Transaction::verify_signature(const cs::PublicKey& public_key) const {
-    const auto byteStream = to_byte_stream_for_sig();
-    return cscrypto::verifySignature(signature().data(), public_key.data(), byteStream.data(), byteStream.size());
+    const auto byteStream = signing_bytes();
+    return cscrypto::verifySignature(signature().data(), public_key.data(), byteStream->data(), byteStream->size());
 }
 
 std::vector<uint8_t> Transaction::to_byte_stream_for_sig() const {
+    return *signing_bytes();
+}
+
+std::shared_ptr<const cs::Bytes> Transaction::signing_bytes() const {
+    const priv* data = d.constData();
+    auto result = std::atomic_load(&data->signing_bytes_);
+
+    if (!result) {
+        result = std::make_shared<const cs::Bytes>(make_signing_bytes());
+        std::atomic_store(&data->signing_bytes_, result);
+    }
+
+    return result;
+}
+
+cs::Hash Transaction::signing_hash() const {
+    const priv* data = d.constData();
+    auto result = std::atomic_load(&data->signing_hash_);
+
+    if (!result) {
+        const auto bytes = signing_bytes();
+        result = std::make_shared<const cs::Hash>(cscrypto::calculateHash(bytes->data(), bytes->size()));
+        std::atomic_store(&data->signing_hash_, result);
+    }
+
+    return *result;
+}
+
+std::shared_ptr<const cs::Bytes> Transaction::binary() const {
+    const priv* data = d.constData();
+    auto result = std::atomic_load(&data->binary_);
+
+    if (!result) {
+        ::csdb::priv::obstream os;
+        put_fields(os);
+        result = std::make_shared<const cs::Bytes>(os.buffer());
+        std::atomic_store(&data->binary_, result);
+    }
+
+    return result;
+}
+
+cs::Bytes Transaction::make_signing_bytes() const {
     ::csdb::priv::obstream os;
     const priv* data = d.constData();
     uint8_t innerID[6];
@@ -302,6 +355,16 @@ std::vector<uint8_t> Transaction::to_byte_stream_for_sig() const {
 }
 
 void Transaction::put(::csdb::priv::obstream& os) const {
+    // do not populate cache here, pools serialize a lot of transactions which are never serialized again
+    if (const auto binary = std::atomic_load(&d.constData()->binary_); binary) {
+        os.put(binary->data(), binary->size());
+    }
+    else {
+        put_fields(os);
+    }
+}
+
+void Transaction::put_fields(::csdb::priv::obstream& os) const {
     const priv* data = d.constData();
     uint8_t innerID[6];
     {
@@ -335,6 +398,7 @@ void Transaction::put(::csdb::priv::obstream& os) const {
 
 bool Transaction::get(::csdb::priv::ibstream& is) {
     priv* data = d.data();
+    data->reset_caches();
     bool res;
 
     {
@@ -11,6 +11,7 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
 #include <csdb/address.hpp>
 #include <csdb/amount.hpp>
@@ -67,7 +68,10 @@ class Transaction::priv : public ::csdb::internal::shared_data {
     , counted_fee_(other.counted_fee_)
     , signature_(other.signature_)
     , user_fields_(other.user_fields_)
-    , time_(other.time_) {
+    , time_(other.time_)
+    , signing_bytes_(std::atomic_load(&other.signing_bytes_))
+    , signing_hash_(std::atomic_load(&other.signing_hash_))
+    , binary_(std::atomic_load(&other.binary_)) {
     }
 
     inline priv(int64_t innerID, Address source, Address target, Currency currency, Amount amount, AmountCommission max_fee, AmountCommission counted_fee, cs::Signature signature)
@@ -82,6 +86,17 @@ class Transaction::priv : public ::csdb::internal::shared_data {
     , signature_(signature) {
     }
 
+    // any change of signed fields makes all cached forms obsolete
+    inline void reset_caches() {
+        std::atomic_store(&signing_bytes_, std::shared_ptr<const cs::Bytes>{});
+        std::atomic_store(&signing_hash_, std::shared_ptr<const cs::Hash>{});
+        reset_binary_cache();
+    }
+
+    inline void reset_binary_cache() {
+        std::atomic_store(&binary_, std::shared_ptr<const cs::Bytes>{});
+    }
+
     inline void _update_id(cs::Sequence pool_seq, cs::Sequence index) {
         id_.d->_update(pool_seq, index);
         read_only_ = true;
@@ -123,6 +138,12 @@ class Transaction::priv : public ::csdb::internal::shared_data {
 
     uint64_t time_{};  // optional, not set automatically
 
+    // lazily built forms of immutable (signed) transaction, shared by copies,
+    // accessed atomically because signed transactions are read by several threads
+    mutable std::shared_ptr<const cs::Bytes> signing_bytes_;
+    mutable std::shared_ptr<const cs::Hash> signing_hash_;
+    mutable std::shared_ptr<const cs::Bytes> binary_;
+
     friend class Transaction;
     friend class Pool;
     friend class ::csdb::internal::shared_data_ptr<priv>;
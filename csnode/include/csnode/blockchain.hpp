@@ -276,6 +276,8 @@ public:
     csdb::Pool loadBlock(const csdb::PoolHash&) const;
     csdb::Pool loadBlock(const cs::Sequence sequence) const;
     csdb::Pool loadBlockMeta(const csdb::PoolHash&, size_t& cnt) const;
+    // loads stored binary of block without decoding, returns false if block is not found
+    bool loadBlockBinary(const cs::Sequence sequence, cs::Bytes& data) const;
     csdb::Transaction loadTransaction(const csdb::TransactionID&) const;
     void iterateOverWallets(const std::function<bool(const cs::PublicKey&, const cs::WalletsCache::WalletData&)>);
     csdb::Pool getLastBlock() const {
@@ -0,0 +1,79 @@
+#ifndef BLOCK_REPLY_CACHE_HPP
+#define BLOCK_REPLY_CACHE_HPP
+
+#include <chrono>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <csdb/pool.hpp>
+#include <csnode/nodecore.hpp>
+#include <lib/system/allocators.hpp>
+#include <lib/system/signals.hpp>
+
+namespace cs {
+///
+/// Compressed block replies of recently requested sequences. Peers catching up request the same
+/// ranges, so a reply is built once and served from cache while it fits into bytes budget.
+/// Least recently used replies are evicted first. Thread safe, replies are built by sync lane
+/// outside of node dispatch.
+///
+class BlockReplyCache {
+public:
+    using Duration = std::chrono::nanoseconds;
+    using Reply = std::shared_ptr<const CompressedRegion>;
+
+    constexpr static size_t kDefaultBytesBudget = 64 * 1024 * 1024;
+
+    explicit BlockReplyCache(size_t bytesBudget = kDefaultBytesBudget);
+
+    // returns cached reply or nullptr
+    Reply find(const PoolsRequestedSequences& sequences);
+
+    // changed by every clear, taken before reading blocks of reply
+    uint64_t generation() const;
+
+    // cost is time spent to build reply, it is counted as saved on each hit,
+    // reply built before the last clear is not inserted
+    void insert(const PoolsRequestedSequences& sequences, CompressedRegion region, Duration cost, uint64_t generation);
+    void clear();
+
+    size_t bytes() const;
+    size_t hits() const;
+    size_t misses() const;
+    double hitRatio() const;
+    Duration savedTime() const;
+
+public slots:
+    // removed block may be replaced by another one, so cached replies are dropped
+    void onRemoveBlock(const csdb::Pool&);
+
+private:
+    struct Entry {
+        PoolsRequestedSequences sequences;
+        Reply region;
+        Duration cost;
+    };
+
+    using Entries = std::list<Entry>;
+
+    void evict();
+
+    mutable std::mutex mutex_;
+
+    const size_t bytesBudget_;
+    size_t bytes_ = 0;
+    uint64_t generation_ = 0;
+
+    // most recently used first
+    Entries entries_;
+    std::map<PoolsRequestedSequences, Entries::iterator> index_;
+
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    Duration savedTime_{};
+};
+}  // namespace cs
+
+#endif  // BLOCK_REPLY_CACHE_HPP
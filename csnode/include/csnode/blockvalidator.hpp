@@ -3,6 +3,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <csdb/pool.hpp>
 
@@ -12,6 +13,7 @@ class BlockChain;
 namespace cs {
 
 class ValidationPlugin;
+class StatelessValidationPlugin;
 class WalletsState;
 
 class BlockValidator {
@@ -42,6 +44,14 @@ public:
     ~BlockValidator();
     bool validateBlock(const csdb::Pool&, ValidationFlags = hashIntergrity, SeverityLevel = greaterThanWarnings);
 
+    // validates consecutive blocks, stateless plugins check all the blocks concurrently,
+    // stateful ones follow block by block, returns count of leading valid blocks
+    size_t validateBlocks(const std::vector<csdb::Pool>&, ValidationFlags = hashIntergrity, SeverityLevel = greaterThanWarnings);
+
+    // runs only stateless plugins of flags and keeps validator state untouched, so it may be called
+    // concurrently with other validation, returns count of leading valid blocks
+    size_t validateStateless(const std::vector<csdb::Pool>&, ValidationFlags = hashIntergrity, SeverityLevel = greaterThanWarnings) const;
+
     BlockValidator(const BlockValidator&) = delete;
     BlockValidator(BlockValidator&&) = delete;
     BlockValidator& operator=(const BlockValidator&) = delete;
@@ -55,7 +65,16 @@ private:
         fatalError = 1 << 3
     };
 
-    bool return_(ErrorType, SeverityLevel);
+    static bool return_(ErrorType, SeverityLevel);
+    csdb::Pool findPrevBlock(const csdb::Pool& block, const csdb::Pool& candidate) const;
+
+    // previous blocks of the leading blocks which have them, candidate is tried for the first one
+    std::vector<csdb::Pool> findPrevBlocks(const std::vector<csdb::Pool>& blocks, const csdb::Pool& candidate) const;
+    std::vector<StatelessValidationPlugin*> statelessPlugins(ValidationFlags) const;
+
+    // checks blocks having previous ones concurrently, results go by block then by plugin
+    static std::vector<ErrorType> runStateless(const std::vector<csdb::Pool>& blocks, const std::vector<csdb::Pool>& prevBlocks,
+                                               const std::vector<StatelessValidationPlugin*>& stateless, SeverityLevel);
 
     Node& node_;
     const BlockChain& bc_;
@@ -8,6 +8,7 @@
 #include <csdb/amount.hpp>
 #include <csdb/transaction.hpp>
 #include <csnode/blockvalidator.hpp>
+#include <csnode/signatureverifier.hpp>
 #include <csnode/transactionspacket.hpp>
 #include <lib/system/common.hpp>
 
@@ -27,6 +28,10 @@ public:
     using ErrorType = BlockValidator::ErrorType;
     virtual ErrorType validateBlock(const csdb::Pool&) = 0;
 
+    virtual bool isStateless() const {
+        return false;
+    }
+
 protected:
     Node& getNode() {
         return blockValidator_.node_;    
@@ -50,6 +55,27 @@ private:
     BlockValidator& blockValidator_;
 };
 
+///
+/// @brief Plugin depends on block and its predecessor only,
+/// so it may validate several blocks concurrently.
+///
+class StatelessValidationPlugin : public ValidationPlugin {
+public:
+    StatelessValidationPlugin(BlockValidator& bv)
+    : ValidationPlugin(bv) {
+    }
+
+    ErrorType validateBlock(const csdb::Pool& block) override {
+        return validateBlock(block, getPrevBlock());
+    }
+
+    virtual ErrorType validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) = 0;
+
+    bool isStateless() const override {
+        return true;
+    }
+};
+
 class SmartStateValidator : public ValidationPlugin {
 public:
     SmartStateValidator(BlockValidator& bv) : ValidationPlugin(bv) {}
@@ -59,36 +85,40 @@ private:
     bool checkNewState(const csdb::Transaction&);
 };
 
-class HashValidator : public ValidationPlugin {
+class HashValidator : public StatelessValidationPlugin {
 public:
     HashValidator(BlockValidator& bv)
-    : ValidationPlugin(bv) {
+    : StatelessValidationPlugin(bv) {
     }
-    ErrorType validateBlock(const csdb::Pool&) override;
+    using StatelessValidationPlugin::validateBlock;
+    ErrorType validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) override;
 };
 
-class BlockNumValidator : public ValidationPlugin {
+class BlockNumValidator : public StatelessValidationPlugin {
 public:
     BlockNumValidator(BlockValidator& bv)
-    : ValidationPlugin(bv) {
+    : StatelessValidationPlugin(bv) {
     }
-    ErrorType validateBlock(const csdb::Pool&) override;
+    using StatelessValidationPlugin::validateBlock;
+    ErrorType validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) override;
 };
 
-class TimestampValidator : public ValidationPlugin {
+class TimestampValidator : public StatelessValidationPlugin {
 public:
     TimestampValidator(BlockValidator& bv)
-    : ValidationPlugin(bv) {
+    : StatelessValidationPlugin(bv) {
     }
-    ErrorType validateBlock(const csdb::Pool&) override;
+    using StatelessValidationPlugin::validateBlock;
+    ErrorType validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) override;
 };
 
-class BlockSignaturesValidator : public ValidationPlugin {
+class BlockSignaturesValidator : public StatelessValidationPlugin {
 public:
     BlockSignaturesValidator(BlockValidator& bv)
-    : ValidationPlugin(bv) {
+    : StatelessValidationPlugin(bv) {
     }
-    ErrorType validateBlock(const csdb::Pool&) override;
+    using StatelessValidationPlugin::validateBlock;
+    ErrorType validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) override;
 };
 
 class SmartSourceSignaturesValidator : public ValidationPlugin {
@@ -149,7 +179,7 @@ public:
     ErrorType validateBlock(const csdb::Pool&) override;
 
 private:
-    bool checkSignature(const csdb::Transaction&);
+    SignatureVerifier::Entry makeSignatureEntry(const csdb::Transaction&);
 };
 
 class AccountBalanceChecker : public ValidationPlugin
@@ -37,7 +37,12 @@ public:
 
         stream << entity;
 
-        auto data = reinterpret_cast<char*>(bytes.data());
+        return compressBinary(bytes);
+    }
+
+    // compresses already serialized entity
+    CompressedRegion compressBinary(const cs::Bytes& bytes) {
+        auto data = reinterpret_cast<const char*>(bytes.data());
         const int binSize = cs::numeric_cast<int>(bytes.size());
 
         const auto maxSize = LZ4_compressBound(binSize);
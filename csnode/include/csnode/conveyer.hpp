@@ -61,6 +61,15 @@ public:
     ///
     void addTransaction(const csdb::Transaction& transaction);
 
+    ///
+    /// @brief Adds transactions to conveyer under single lock.
+    /// @param transactions Valid csdb transactions.
+    /// @return Result of each transaction, transactions are added in order
+    /// until packet queue is full, the ones with signature already queued
+    /// or repeated in the batch are rejected.
+    ///
+    std::vector<cs::PacketQueue::PushResult> addTransactions(const std::vector<csdb::Transaction>& transactions);
+
     ///
     /// @brief Adds packet to transactions block as monolith entity.
     /// @param packet Created from outside packet with transactions.
@@ -73,6 +82,7 @@ public:
     /// @param packet Created from network transactions packet.
     ///
     void addTransactionsPacket(const cs::TransactionsPacket& packet);
+    void addTransactionsPacket(cs::TransactionsPacket&& packet);
 
     ///
     /// @brief Returns current round transactions packet hash table.
@@ -245,10 +255,10 @@ public:
     ///
     /// @brief Searches transactions packet in current hash table, or in hash table storage.
     /// @param hash Created transactions packet hash.
-    /// @return Returns transactions packet if its found, otherwise returns nothing.
+    /// @return Returns shared immutable transactions packet if its found, otherwise returns nullptr.
     /// @warning No thread safe.
     ///
-    std::optional<cs::TransactionsPacket> findPacket(const cs::TransactionsPacketHash& hash, const cs::RoundNumber round) const;
+    cs::TransactionsPacketPtr findPacket(const cs::TransactionsPacketHash& hash, const cs::RoundNumber round) const;
 
     ///
     /// @brief Returns existing of invalid transaction in meta storage.
@@ -287,17 +297,17 @@ private slots:
     void onRoundChanged(cs::RoundNumber round);
 
 protected:
-    void addPacketToMeta(cs::TransactionsPacket& packet);
+    void addPacketToMeta(cs::TransactionsPacket&& packet);
     void changeRound(cs::RoundNumber round);
 
     // searches transactions packet at all conveyer cache
-    std::optional<cs::TransactionsPacket> findPacketAtMeta(const cs::TransactionsPacketHash& hash) const;
+    cs::TransactionsPacketPtr findPacketAtMeta(const cs::TransactionsPacketHash& hash) const;
 
     void removeHashesFromTable(const cs::PacketsHashes& hashes);
     cs::TransactionsPacketTable& poolTable(cs::RoundNumber round);
 
     // returns true if packet is found at cache, otherwise - false
-    bool isPacketAtCache(const cs::TransactionsPacket& packet);
+    bool isPacketAtCache(const cs::TransactionsPacketHash& hash);
 
 private:
     struct Impl;
@@ -2,6 +2,7 @@
 #define ITER_VALIDATOR_HPP
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -37,7 +38,8 @@ private:
 
     void checkSignaturesSmartSource(SolverContext&, PacketsVector& smartContractsPackets);
     void checkTransactionsSignatures(SolverContext& context, const Transactions& transactions, Bytes& characteristicMask, PacketsVector& smartsPackets);
-    bool checkTransactionSignature(SolverContext& context, const csdb::Transaction& transaction);
+    // returns decision if signature verification is not required, otherwise sets key to verify with
+    std::optional<bool> checkTransactionSignature(SolverContext& context, const csdb::Transaction& transaction, cs::PublicKey& key);
 
 	Reject::Reason deployAdditionalCheck(SolverContext& context, size_t trxInd, const csdb::Transaction& transaction);
 
@@ -75,8 +77,9 @@ public:
     /// 5. 
     ///
     /// New states and smart source transactions will be banned, use full validation.
+    /// Signature check may be skipped if it is verified by batch outside.
     static bool validate(const csdb::Transaction&, const BlockChain&, SmartContracts&,
-                         csdb::AmountCommission* countedFee = nullptr, RejectCode* rc = nullptr);
+                         csdb::AmountCommission* countedFee = nullptr, RejectCode* rc = nullptr, bool checkSignature = true);
 };
 }  // namespace cs
 #endif  // ITER_VALIDATOR_HPP
@@ -64,7 +64,7 @@ public:
     }
 
 public slots:
-    void onDbReadFinished(const std::unordered_map<PublicKey, WalletsCache::WalletData>& data);
+    void onDbReadFinished(const WalletsCache::Wallets& data);
     void onWalletCacheUpdated(const PublicKey& key, const WalletsCache::WalletData& data);
 
 protected:
@@ -3,12 +3,14 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <csstats.hpp>
 
 #include <csconnector/csconnector.hpp>
 
+#include <csnode/blockreplycache.hpp>
 #include <csnode/conveyer.hpp>
 #include <csnode/compressor.hpp>
 
@@ -29,6 +31,7 @@ class SolverCore;
 namespace cs {
 class PoolSynchronizer;
 class BlockValidator;
+class StartupValidator;
 }  // namespace cs
 
 namespace cs::config {
@@ -190,19 +193,30 @@ public:
     void sendStateReply(const cs::PublicKey& respondent, const csdb::Address& contract_abs_addr, const cs::Bytes& data);
     void getStateReply(const uint8_t*, const std::size_t, const cs::RoundNumber, const cs::PublicKey& sender);
 
-    // syncro get functions
+    // block reply decoded and checked ahead of storing
+    struct SyncedBlocks {
+        cs::PoolsBlock blocks;
+        // count of leading valid blocks, known if the reply continues own chain ending with lastHash
+        std::optional<size_t> validCount;
+        csdb::PoolHash lastHash;
+    };
+
+    // syncro get functions, getBlockRequest and prepareBlockReply are thread safe
+    // and do not change node state, so the sync lane runs them outside of dispatch
     void getBlockRequest(const uint8_t*, const size_t, const cs::PublicKey& sender);
-    void getBlockReply(const uint8_t*, const size_t);
+    void getBlockReply(const uint8_t*, const size_t, const cs::PublicKey& sender);
+    SyncedBlocks prepareBlockReply(const uint8_t*, const size_t);
+    void getBlockReply(SyncedBlocks&& syncedBlocks, const cs::PublicKey& sender);
 
     // transaction's pack syncro
     void sendTransactionsPacket(const cs::TransactionsPacket& packet);
     void sendPacketHashesRequest(const cs::PacketsHashes& hashes, const cs::RoundNumber round, uint32_t requestStep);
-    void sendPacketHashesReply(const cs::PacketsVector& packets, const cs::RoundNumber round, const cs::PublicKey& target);
+    void sendPacketHashesReply(const cs::SharedPacketsVector& packets, const cs::RoundNumber round, const cs::PublicKey& target);
 
     // smarts consensus additional functions:
 
     // syncro send functions
-    void sendBlockReply(const cs::PoolsBlock& poolsBlock, const cs::PublicKey& target);
+    void sendBlockReply(const cs::PoolsRequestedSequences& sequences, const cs::PublicKey& target);
 
     /**
      * Initializes the default round package as containing the default round table (default trusted
@@ -275,7 +289,7 @@ public:
 
     /**
      * Gets known peers obtained by special discovery service. Caller MUST care about concurrency.
-     * One SHOULD make a call to this from CallsQueue or directly from processorRoutine
+     * One SHOULD make a call to this from CallsQueue or directly from a transport lane worker
      *
      * @author  Alexander Avramenko
      * @date    12.02.2020
@@ -291,7 +305,7 @@ public:
 
     /**
      * Gets node information. Caller MUST care about concurrency.
-     * One SHOULD make a call to this from CallsQueue or directly from processorRoutine
+     * One SHOULD make a call to this from CallsQueue or directly from a transport lane worker
      *
      * @author  Alexander Avramenko
      * @date    13.02.2020
@@ -335,6 +349,7 @@ public slots:
     void processSpecialInfo(const csdb::Pool& pool);
     void validateBlock(const csdb::Pool& block, bool* shouldStop);
     void deepBlockValidation(csdb::Pool block, bool* shouldStop);
+    void deepValidateReadBlock(const csdb::Pool& block, bool* shouldStop);
     void sendBlockAlarmSignal(cs::Sequence seq);
     void onRoundTimeElapsed();
     void onNeighbourAdded(const cs::PublicKey& neighbour, cs::Sequence lastSeq, cs::RoundNumber lastRound);
@@ -420,6 +435,9 @@ private:
     static const size_t maxPacketRequestSize_ = 1000;
     static const size_t kLastPoolSynchroDelay_ = 30000;
 
+    // the first packet hashes request goes to the best neighbours only, repeated ones go to all
+    static const size_t kPacketRequestRelays_ = 3;
+
     cs::PoolSynchronizer* poolSynchronizer_;
 
     // sends transactions blocks to network
@@ -466,6 +484,7 @@ private:
     cs::RoundTableMessage currentRoundTableMessage_;
 
     std::unique_ptr<cs::BlockValidator> blockValidator_;
+    std::unique_ptr<cs::StartupValidator> startupValidator_;
     std::vector<cs::RoundPackage> roundPackageCache_;
 
     cs::RoundPackage currentRoundPackage_;
@@ -477,6 +496,7 @@ private:
 
     cs::config::Observer& observer_;
     cs::Compressor compressor_;
+    cs::BlockReplyCache blockReplyCache_;
 
     std::string kLogPrefix_;
     std::map<uint16_t, cs::Command> changeableParams_;
@@ -24,7 +24,7 @@ struct hash<cs::TransactionsPacketHash> {
 
 namespace cs {
 // table for fast transactions storage
-using TransactionsPacketTable = std::map<TransactionsPacketHash, TransactionsPacket>;   // to be sorted by default
+using TransactionsPacketTable = std::map<TransactionsPacketHash, TransactionsPacketPtr>;   // to be sorted by default
 
 // array of notifications
 using Notifications = std::vector<cs::Bytes>;
@@ -36,6 +36,7 @@ using PrivateKeys = std::vector<PrivateKey>;
 using ConfidantsKeys = PublicKeys;
 using PacketsHashes = std::vector<cs::TransactionsPacketHash>;
 using PacketsVector = std::vector<cs::TransactionsPacket>;
+using SharedPacketsVector = std::vector<cs::TransactionsPacketPtr>;
 using Signatures = std::vector<cs::Signature>;
 using Hashes = std::vector<cs::Hash>;
 
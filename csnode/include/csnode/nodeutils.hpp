@@ -10,7 +10,16 @@ class Pool;
 namespace cs {
 class NodeUtils {
 public:
+    // signatures of the trusted confidants on one hash
+    struct GroupSignature {
+        const cs::Signatures* signatures;
+        cs::Hash hash;
+    };
+
     static bool checkGroupSignature(const cs::ConfidantsKeys& confidants, const cs::Bytes& mask, const cs::Signatures& signatures, const cs::Hash& hash);
+
+    // checks several groups signed by the same trusted confidants as one parallel batch
+    static bool checkGroupSignatures(const cs::ConfidantsKeys& confidants, const cs::Bytes& mask, const std::vector<GroupSignature>& groups);
     static size_t realTrustedValue(const cs::Bytes& mask);
     static cs::Bytes getTrustedMask(const csdb::Pool& block);
     static std::string roundsToString(const std::vector<cs::RoundNumber>& rounds);
@@ -181,6 +181,18 @@ inline ODataStream<T>& operator<<(ODataStream<T>& stream, const cs::Transactions
     return stream;
 }
 
+template<typename T>
+inline ODataStream<T>& operator<<(ODataStream<T>& stream, const cs::TransactionsPacketPtr& packet) {
+    if (const auto& binary = packet->cachedBinary(); binary) {
+        stream << *binary;
+    }
+    else {
+        stream << packet->toBinary();
+    }
+
+    return stream;
+}
+
 template<typename T>
 inline ODataStream<T>& operator<<(ODataStream<T>& stream, const csdb::PoolHash& hash) {
     stream << hash.to_binary();
@@ -191,7 +203,7 @@ template<typename T>
 inline ODataStream<T>& operator<<(ODataStream<T>& stream, const csdb::Pool& pool) {
     uint32_t bSize;
     auto dataPtr = const_cast<csdb::Pool&>(pool).to_byte_stream(bSize);
-    stream << cs::Bytes(dataPtr, dataPtr + bSize);
+    stream << cs::BytesView(reinterpret_cast<cs::Byte*>(dataPtr), bSize);
     return stream;
 }
 
@@ -3,6 +3,8 @@
 
 #include <deque>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include <csnode/nodecore.hpp>
 #include <boost/noncopyable.hpp>
@@ -11,28 +13,49 @@ namespace cs {
 // implements business logic for transpaction packet
 class PacketQueue : public boost::noncopyable {
 public:
+    enum class PushResult : uint8_t {
+        Pushed,
+        Duplicate,
+        Full
+    };
+
     explicit PacketQueue(size_t queueSize, size_t transactionsSize, size_t packetsPerRound);
     ~PacketQueue() = default;
 
     bool push(const csdb::Transaction& transaction);
     void push(const cs::TransactionsPacket& packet);
 
+    // pushes transactions in order until queue is full, transactions with signature already queued
+    // or met earlier in the batch are skipped, returns result of each transaction
+    std::vector<PushResult> push(const std::vector<csdb::Transaction>& transactions);
+
+    bool contains(const cs::Signature& signature) const;
+
     cs::PacketsVector pop();
 
     std::deque<cs::TransactionsPacket>::const_iterator begin() const;
     std::deque<cs::TransactionsPacket>::const_iterator end() const;
 
     size_t size() const;
+    size_t transactionsCount() const;
     bool isEmpty() const;
     std::deque<cs::TransactionsPacket>::const_reference back() const;
 
 private:
+    void add(const cs::TransactionsPacket& packet);
+    void remove(const cs::TransactionsPacket& packet);
+
     std::deque<cs::TransactionsPacket> queue_;
 
+    // queued transactions count by signature
+    std::unordered_map<cs::Signature, size_t> signatures_;
+
     size_t maxQueueSize_;
     size_t maxTransactionsSize_;
     size_t maxPacketsPerRound_;
 
+    size_t transactionsCount_;
+
     cs::RoundNumber cachedRound_;
     size_t cachedPackets_;
 };
@@ -13,7 +13,14 @@ public:
     bool fromBinary(const cs::Bytes& bytes, cs::RoundNumber rNum, cs::Byte subRound);
 
     std::string toString();
-    cs::Bytes bytesToSign();
+
+    // round signatures sign hash of these bytes, both are built once until round table or meta is updated
+    const cs::Bytes& bytesToSign();
+    const cs::Hash& hashToSign();
+
+    // trusted signatures sign hash of round table binary
+    const cs::Hash& roundTableHash();
+
     const cs::RoundTable& roundTable() const;
     const cs::PoolMetaInfo& poolMetaInfo() const;
 
@@ -51,6 +58,7 @@ private:
     }
 
     void refillToSign();
+    void resetToSign();
 
     cs::RoundTable roundTable_;
     cs::PoolMetaInfo poolMetaInfo_;  // confirmations sent in rt are confirmations for next pool
@@ -63,6 +71,14 @@ private:
 
     cs::Bytes binaryRepresentation_;
     size_t messageSize_ = 0;
+
+    cs::Bytes bytesToSign_;
+    cs::Hash hashToSign_{};
+    bool toSignCached_ = false;
+
+    cs::Hash roundTableHash_{};
+    bool roundTableHashCached_ = false;
+
     cs::Byte iteration_ = 0U;
     cs::Byte subRound_ = 0U;
 
@@ -0,0 +1,80 @@
+#ifndef SIGNATURESCACHE_HPP
+#define SIGNATURESCACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include <lib/system/common.hpp>
+#include <lib/system/flathashmap.hpp>
+
+namespace cs {
+///
+/// Bounded thread safe memo of recently verified signatures.
+/// Key is hash of signed bytes hash, public key and signature, so only the same
+/// signature of the same data by the same key is treated as verified.
+/// Only successful verifications are stored, the oldest entries are evicted first.
+///
+class SignaturesCache {
+public:
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+
+        // time spent to verify missed signatures
+        std::chrono::nanoseconds verifyTime{0};
+
+        double hitRate() const;
+
+        // estimated by average verification time of misses
+        std::chrono::nanoseconds savedTime() const;
+    };
+
+    constexpr static size_t kDefaultCapacity = 1 << 18;
+    constexpr static size_t kShardsCount = 16;
+
+    explicit SignaturesCache(size_t capacity = kDefaultCapacity);
+
+    // node wide instance used by SignatureVerifier
+    static SignaturesCache& instance();
+
+    // message hash is known for transactions (csdb::Transaction::signing_hash), so no copy of message is made
+    static cs::Hash makeKey(const cs::Hash& messageHash, const cs::PublicKey& key, const cs::Signature& signature);
+
+    // returns true if key was verified before, counts hit or miss
+    bool contains(const cs::Hash& key);
+    void insert(const cs::Hash& key);
+
+    void addVerifyTime(std::chrono::nanoseconds time);
+
+    size_t size() const;
+    size_t capacity() const;
+    void clear();
+
+    Statistics statistics() const;
+
+    // returns statistics collected since previous call and resets it
+    Statistics takeStatistics();
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        cs::FlatHashMap<cs::Hash, cs::Byte> keys;
+        std::vector<cs::Hash> order;
+        size_t next = 0;
+    };
+
+    Shard& shard(const cs::Hash& key);
+
+    const size_t shardCapacity_;
+    std::array<Shard, kShardsCount> shards_;
+
+    std::atomic<size_t> hits_ = 0;
+    std::atomic<size_t> misses_ = 0;
+    std::atomic<int64_t> verifyTime_ = 0;
+};
+}  // namespace cs
+
+#endif  // SIGNATURESCACHE_HPP
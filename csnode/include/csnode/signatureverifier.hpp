@@ -0,0 +1,71 @@
+#ifndef SIGNATUREVERIFIER_HPP
+#define SIGNATUREVERIFIER_HPP
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <lib/system/common.hpp>
+
+namespace csdb {
+class Transaction;
+}
+
+namespace cs {
+///
+/// Central signatures verification service.
+/// Verifies batches of (message, public key, signature) entries
+/// by all cores of thread pool, calling thread takes part too.
+///
+class SignatureVerifier {
+public:
+    struct Entry {
+        // shared with entries of the same message and with transaction serialization cache
+        std::shared_ptr<const cs::Bytes> message;
+        cs::PublicKey publicKey;
+        cs::Signature signature;
+
+        // successful result is stored at SignaturesCache and looked up there first,
+        // set for transactions which are verified several times during their life
+        bool memoize = false;
+
+        // hash of message as SignaturesCache key part, calculated if not set
+        std::optional<cs::Hash> messageHash;
+    };
+
+    using Batch = std::vector<Entry>;
+
+    // result of each batch entry in the same order, not zero if signature is valid
+    using Results = std::vector<cs::Byte>;
+
+    // min count of entries verified by one pool task
+    constexpr static size_t kMinChunkSize = 16;
+
+    ///
+    /// @brief Creates memoized transaction signature entry.
+    /// @param key Public key of transaction source, already resolved from wallet id if needed.
+    ///
+    static Entry makeEntry(const csdb::Transaction& transaction, const cs::PublicKey& key);
+
+    ///
+    /// @brief Creates entry of signed hash.
+    ///
+    static Entry makeEntry(const cs::Hash& hash, const cs::PublicKey& key, const cs::Signature& signature);
+
+    ///
+    /// @brief Verifies each entry of batch.
+    /// @return Results with the same size as batch.
+    ///
+    static Results verify(const Batch& batch);
+
+    ///
+    /// @brief Returns true if all batch signatures are valid,
+    /// stops verification at first invalid one.
+    ///
+    static bool verifyAll(const Batch& batch);
+
+    static bool verify(const Entry& entry);
+};
+}  // namespace cs
+
+#endif  // SIGNATUREVERIFIER_HPP
@@ -0,0 +1,92 @@
+#ifndef STARTUPVALIDATOR_HPP
+#define STARTUPVALIDATOR_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <csdb/pool.hpp>
+#include <csnode/blockvalidator.hpp>
+#include <lib/system/common.hpp>
+#include <lib/system/mmappedfile.hpp>
+#include <lib/system/signals.hpp>
+
+namespace cs {
+///
+/// Deep validation of blocks read from DB on start.
+/// Stateless checks of read blocks are run by ranges on thread pool,
+/// the last fully validated block is stored as checkpoint,
+/// so the next start validates only blocks following it.
+///
+class StartupValidator {
+public:
+    // blocks validated concurrently at once
+    constexpr static size_t kRangeSize = 2048;
+
+    // progress is reported not more often
+    constexpr static std::chrono::seconds kReportPeriod{10};
+
+    constexpr static BlockValidator::ValidationFlags kStatelessFlags =
+        BlockValidator::hashIntergrity | BlockValidator::blockNum | BlockValidator::blockSignatures;
+
+    StartupValidator(BlockValidator& validator, const std::string& dbPath);
+    virtual ~StartupValidator() = default;
+
+    // blocks up to checkpoint were validated on one of previous starts
+    bool isCheckpointed(cs::Sequence sequence) const {
+        return sequence <= checkpoint_.sequence;
+    }
+
+    cs::Sequence checkpoint() const {
+        return checkpoint_.sequence;
+    }
+
+    // returns false if block is invalid or it completes the range containing invalid block
+    bool onReadBlock(const csdb::Pool& block);
+
+public slots:
+    void onStartReading(cs::Sequence lastSequence);
+
+protected:
+    // validation is done by overridden checks, tests use it
+    explicit StartupValidator(const std::string& dbPath);
+
+    // checks block not above checkpoint
+    virtual bool validateCheckpointed(const csdb::Pool& block);
+
+    // returns count of leading valid blocks of range
+    virtual size_t validateBlocks(const std::vector<csdb::Pool>& blocks);
+
+private:
+    struct Checkpoint {
+        cs::Sequence sequence = 0;
+        cs::Hash hash{};
+    };
+
+    static Checkpoint readCheckpoint(const std::string& path);
+    void storeCheckpoint(const Checkpoint& checkpoint);
+    static cs::Hash blockHash(const csdb::Pool& block);
+
+    bool validateRange();
+    void reportProgress(bool finished);
+
+    BlockValidator* validator_ = nullptr;
+
+    Checkpoint checkpoint_;
+    MMappedFileWrap<FileSink> checkpointFile_;
+
+    // chain differs from the checkpointed one, it is not advanced until the next start
+    bool checkpointMismatch_ = false;
+
+    std::vector<csdb::Pool> range_;
+
+    cs::Sequence lastSequence_ = 0;
+    cs::Sequence firstSequence_ = 0;
+    size_t validatedCount_ = 0;
+
+    std::chrono::steady_clock::time_point startTime_;
+    std::chrono::steady_clock::time_point reportTime_;
+};
+}  // namespace cs
+
+#endif  // STARTUPVALIDATOR_HPP
@@ -0,0 +1,122 @@
+#ifndef SYNC_SCHEDULER_HPP
+#define SYNC_SCHEDULER_HPP
+
+#include <chrono>
+#include <deque>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <csnode/nodecore.hpp>
+
+namespace cs {
+///
+/// Plans block requests of synchronization as a sliding window over required sequences.
+/// Every neighbour keeps several requests in flight, request size follows measured neighbour
+/// throughput and request timeout follows measured round trip time, so sequences of a slow
+/// or silent neighbour are given to others as soon as its request expires.
+/// Time is passed by caller, so the scheduler is driven by timers and simulations alike.
+///
+class SyncScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration = Clock::duration;
+
+    // required sequences, zero upper bound means no bound
+    using Interval = std::pair<cs::Sequence, cs::Sequence>;
+
+    struct Settings {
+        size_t minRequestSize = 1;
+        size_t maxRequestSize = 100;
+        size_t initialRequestSize = 10;
+        size_t maxRequestsInFlight = 4;
+
+        // request is sized to be answered within this time
+        Duration targetRequestTime = std::chrono::seconds(1);
+
+        Duration initialRtt = std::chrono::seconds(1);
+        Duration minTimeout = std::chrono::milliseconds(500);
+        Duration maxTimeout = std::chrono::seconds(30);
+    };
+
+    struct Request {
+        cs::PublicKey target;
+        PoolsRequestedSequences sequences;
+    };
+
+    SyncScheduler();
+    explicit SyncScheduler(const Settings& settings);
+
+    // adds neighbour or updates its max sequence
+    void addNeighbour(const cs::PublicKey& key, cs::Sequence maxSequence);
+
+    // sequences requested from neighbour are requested from others
+    void removeNeighbour(const cs::PublicKey& key);
+
+    // network round trip time measured by pings, it orders neighbours of equal throughput
+    void setNeighbourRtt(const cs::PublicKey& key, Duration rtt);
+
+    // received sequences complete the neighbour request, the rest of it is requested again
+    void onReply(const cs::PublicKey& key, const PoolsRequestedSequences& received, TimePoint now);
+
+    // written or cached sequence is not requested any more
+    void onStored(cs::Sequence sequence);
+
+    // expires late requests and fills free request slots of neighbours,
+    // sequences past limit are not requested as they can not be written yet
+    std::vector<Request> schedule(const std::vector<Interval>& required, cs::Sequence limit, TimePoint now);
+
+    // drops requests in flight, measurements of neighbours are kept
+    void reset();
+
+    size_t inFlightCount() const {
+        return inFlight_.size();
+    }
+
+    size_t neighboursCount() const {
+        return neighbours_.size();
+    }
+
+    size_t timeoutsCount() const {
+        return timeouts_;
+    }
+
+private:
+    struct PendingRequest {
+        TimePoint sentAt;
+        TimePoint deadline;
+        PoolsRequestedSequences sequences;
+    };
+
+    struct Neighbour {
+        cs::PublicKey key;
+        cs::Sequence maxSequence = 0;
+
+        std::deque<PendingRequest> requests;
+        size_t requestsLimit = 1;
+
+        // blocks per second, zero until the first reply
+        double throughput = 0;
+        Duration rtt{};
+        TimePoint lastReply{};
+
+        Duration pingRtt = Duration::max();
+    };
+
+    Neighbour* findNeighbour(const cs::PublicKey& key);
+    void release(const PendingRequest& request);
+    void steal(const std::vector<Neighbour*>& order, std::vector<Request>& result, TimePoint now);
+    void expire(TimePoint now);
+
+    size_t requestSize(const Neighbour& neighbour) const;
+    Duration timeout(const Neighbour& neighbour) const;
+
+    Settings settings_;
+    std::vector<Neighbour> neighbours_;
+    std::set<cs::Sequence> inFlight_;
+    size_t timeouts_ = 0;
+};
+}  // namespace cs
+
+#endif  // SYNC_SCHEDULER_HPP
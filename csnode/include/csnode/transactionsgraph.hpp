@@ -0,0 +1,88 @@
+#ifndef TRANSACTIONS_GRAPH_HPP
+#define TRANSACTIONS_GRAPH_HPP
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <csdb/amount.hpp>
+#include <csdb/amount_commission.hpp>
+#include <csdb/transaction.hpp>
+#include <csnode/eventreport.hpp>
+#include <csnode/walletsstate.hpp>
+#include <lib/system/common.hpp>
+
+namespace cs {
+///
+/// Dependency graph of round transactions, wallets are nodes and included transactions are edges
+/// from source to target wallet. Negative balances are fixed by removing transactions, removal changes
+/// only source and target of transaction, so the graph is built once from negative wallets and
+/// wallets not connected by edges are processed in parallel.
+/// Result does not depend on threads count, each component keeps order of the serial processing.
+///
+class TransactionsGraph {
+public:
+    using Node = WalletsState::WalletData;
+    using TransactionIndex = WalletsState::TransactionIndex;
+    using TrxList = std::vector<TransactionIndex>;
+    using Stack = std::vector<Node*>;
+    using Transactions = std::vector<csdb::Transaction>;
+    using CharacteristicMask = cs::Bytes;
+
+    struct Target {
+        Node* node = nullptr;
+        bool isSmart = false;
+    };
+
+    // resolves target wallet of transaction, called serially once per transaction
+    using TargetResolver = std::function<Target(const csdb::Address&)>;
+
+    // components are processed in parallel by chunks of this size at least
+    constexpr static size_t kMinComponentsChunk = 16;
+
+    // trxList links transactions of each wallet starting from Node::lastTrxInd_
+    TransactionsGraph(const Transactions& trxs, TrxList& trxList, CharacteristicMask& maskIncluded);
+
+    // removes transactions until negative nodes become non-negative, negativeNodes are consumed,
+    // returns count of removed transactions
+    size_t resolve(Stack& negativeNodes, const TargetResolver& resolver);
+
+private:
+    struct Edge {
+        Node* target = nullptr;
+        csdb::Amount amount;
+        // max fee for smart contract target, counted fee otherwise
+        csdb::Amount fee;
+        // amount with fee compared with absolute negative balance
+        csdb::Amount cost;
+    };
+
+    struct Component {
+        Stack negativeNodes;
+        size_t removed = 0;
+    };
+
+    void build(const Stack& negativeNodes, const TargetResolver& resolver);
+    size_t nodeId(Node* node, Stack& pending);
+    size_t find(size_t id);
+    void unite(size_t lhs, size_t rhs);
+
+    void process(Component& component);
+    void removeTransactions(Node& node, Component& component);
+    bool removeTransactions_PositiveOne(Node& node, Component& component);
+    bool removeTransactions_PositiveAll(Node& node, Component& component);
+    bool removeTransactions_NegativeOne(Node& node, Component& component);
+    bool removeTransactions_NegativeAll(Node& node, Component& component);
+    void remove(Node& node, TransactionIndex* prevNext, TransactionIndex trxInd, Component& component);
+
+    const Transactions& trxs_;
+    TrxList& trxList_;
+    CharacteristicMask& maskIncluded_;
+
+    std::vector<Edge> edges_;
+    std::vector<size_t> parents_;
+    std::unordered_map<Node*, size_t> nodeIds_;
+};
+}  // namespace cs
+
+#endif  // TRANSACTIONS_GRAPH_HPP
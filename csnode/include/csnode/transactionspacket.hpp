@@ -4,10 +4,18 @@
 #include <csdb/transaction.hpp>
 #include <lib/system/common.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace cs {
+class TransactionsPacket;
+
+///
+/// Immutable transactions packet shared between conveyer, node and transport
+///
+using TransactionsPacketPtr = std::shared_ptr<const TransactionsPacket>;
+
 ///
 /// Wrapper of std::vector<uint8_t> to represent hash
 ///
@@ -99,6 +107,14 @@ public:  // Static interface
     ///
     static TransactionsPacket fromByteStream(const char* data, size_t size);
 
+    ///
+    /// @brief Freezes packet to immutable shared state.
+    /// @param packet Packet to share, hash is generated if it is empty.
+    /// @return Shared packet with cached binary representation.
+    /// @warning After sharing packet can not be changed, make a copy to modify it.
+    ///
+    static TransactionsPacketPtr share(TransactionsPacket&& packet);
+
 public:  // Interface
     enum Serialization : cs::Byte {
         Transactions = 0x01,
@@ -122,6 +138,12 @@ public:  // Interface
     ///
     cs::Bytes toBinary(Serialization options = Serialization::All) const noexcept;
 
+    ///
+    /// @brief Returns cached full binary representation of shared packet.
+    /// @return Cached bytes if packet was shared, otherwise nullptr.
+    ///
+    const std::shared_ptr<const cs::Bytes>& cachedBinary() const noexcept;
+
     ///
     /// @brief Generates hash
     /// @return True if hash generated successed
@@ -216,12 +238,17 @@ private:  // Service
     void put(::csdb::priv::obstream& os, Serialization options) const;
     bool get(::csdb::priv::ibstream& is);
 
+    void resetCache() noexcept;
+
 private:  // Members
     TransactionsPacketHash hash_;
     std::vector<csdb::Transaction> transactions_;
     std::vector<csdb::Transaction> stateTransactions_;
     cs::BlockSignatures signatures_;
     cs::RoundNumber expiredRound_{};
+
+    // full serialization, filled once by share()
+    std::shared_ptr<const cs::Bytes> binary_;
 };
 }  // namespace cs
 
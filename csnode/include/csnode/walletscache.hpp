@@ -3,7 +3,6 @@
 
 #include <list>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include <tuple>
 
@@ -16,6 +15,7 @@
 #include <csnode/transactionstail.hpp>
 
 #include <lib/system/common.hpp>
+#include <lib/system/flathashmap.hpp>
 #include <lib/system/signals.hpp>
 
 class BlockChain;
@@ -57,6 +57,8 @@ public:
 #endif
     };
 
+    using Wallets = cs::FlatHashMap<PublicKey, WalletData>;
+
     struct TrustedData {
         uint64_t times = 0;
         uint64_t times_trusted = 0;
@@ -78,7 +80,7 @@ private:
 
     std::list<csdb::TransactionID> smartPayableTransactions_;
     std::map< csdb::Address, std::list<csdb::TransactionID> > canceledSmarts_;
-    std::unordered_map<PublicKey, WalletData> wallets_;
+    Wallets wallets_;
     DelegationsTiming currentDelegations_;
 
 #ifdef MONITOR_NODE
@@ -87,7 +89,7 @@ private:
 };
 
 using WalletUpdateSignal = cs::Signal<void(const PublicKey&, const WalletsCache::WalletData&)>;
-using FinishedUpdateFromDB = cs::Signal<void(const std::unordered_map<PublicKey, WalletsCache::WalletData>&)>;
+using FinishedUpdateFromDB = cs::Signal<void(const WalletsCache::Wallets&)>;
 
 
 class WalletsCache::Updater {
@@ -1,7 +1,9 @@
 #ifndef WALLETS_STATE_HPP
 #define WALLETS_STATE_HPP
 
-#include <unordered_map>
+#include <map>
+#include <memory>
+#include <vector>
 
 #include <csdb/address.hpp>
 #include <csdb/amount.hpp>
@@ -9,34 +11,89 @@
 #include <csnode/transactionstail.hpp>
 #include <csnode/walletscache.hpp>
 
+#include <lib/system/flathashmap.hpp>
+
 namespace cs {
 class WalletsCache;
 class WalletsIds;
 
+///
+/// Per round overlay over WalletsCache: wallets touched by round get mutable copies of balance and
+/// transactions tail, delegations are read from WalletsCache data directly.
+/// Copies live in arena of chunks which is kept between rounds, so reset is O(1) and
+/// rounds touching not more wallets than previous ones do not allocate.
+///
 class WalletsState {
 public:
     using WalletAddress = csdb::Address;
     using TransactionIndex = uint32_t;
+    using Delegations = std::vector<cs::TimeMoney>;
 
     static constexpr TransactionIndex noInd_ = std::numeric_limits<TransactionIndex>::max();
 
+    // wallet copies are allocated by chunks of this size
+    static constexpr size_t kChunkSize = 1024;
+
+    // index of touched wallets is dropped on reset if it grows over this size
+    static constexpr size_t kMaxIndexSize = 1024 * 1024;
+
     struct WalletData {
         TransactionIndex lastTrxInd_{};
         csdb::Amount balance_{};
         csdb::Amount delegated_{};
-        std::map<cs::PublicKey, std::vector<cs::TimeMoney>> delegateSources_{};
-        std::map<cs::PublicKey, std::vector<cs::TimeMoney>> delegateTargets_{};
         TransactionsTail trxTail_{};
+
+        // shared data of WalletsCache, nullptr if wallet is new
+        const WalletsCache::WalletData* cached_ = nullptr;
+
+        // delegations of this wallet to target, nullptr if there are none
+        const Delegations* delegateTarget(const PublicKey& target) const {
+            return cached_ ? find(cached_->delegateTargets_.get(), target) : nullptr;
+        }
+
+        // delegations from source to this wallet, nullptr if there are none
+        const Delegations* delegateSource(const PublicKey& source) const {
+            return cached_ ? find(cached_->delegateSources_.get(), source) : nullptr;
+        }
+
+    private:
+        static const Delegations* find(const std::map<cs::PublicKey, Delegations>* delegations, const PublicKey& key) {
+            if (delegations == nullptr) {
+                return nullptr;
+            }
+
+            auto iter = delegations->find(key);
+            return iter != delegations->end() ? &iter->second : nullptr;
+        }
     };
 
     explicit WalletsState(const WalletsCache::Updater& cacheUpd) : wallCache_(cacheUpd) {}
     WalletData& getData(const WalletAddress& address);
 
-    void updateFromSource() { storage_.clear(); }
+    // drops copies of the previous round
+    void updateFromSource();
+
+    // count of wallets touched since the last reset
+    size_t size() const {
+        return used_;
+    }
 
 private:
+    struct Entry {
+        uint64_t round = 0;
+        WalletData* data = nullptr;
+    };
+
+    WalletData* allocate();
+
     const WalletsCache::Updater& wallCache_;
-    std::unordered_map<PublicKey, WalletData> storage_;
+
+    // touched wallets, entries of previous rounds are stale
+    cs::FlatHashMap<PublicKey, Entry> index_;
+    uint64_t round_ = 1;
+
+    std::vector<std::unique_ptr<WalletData[]>> chunks_;
+    size_t used_ = 0;
 };
 }  // namespace cs
 #endif // WALLETS_STATE_HPP
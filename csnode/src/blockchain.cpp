@@ -314,6 +314,22 @@ csdb::Pool BlockChain::loadBlock(const cs::Sequence sequence) const {
     return storage_.pool_load(sequence);
 }
 
+bool BlockChain::loadBlockBinary(const cs::Sequence sequence, cs::Bytes& data) const {
+    std::lock_guard lock(dbLock_);
+
+    if (deferredBlock_.is_valid() && deferredBlock_.sequence() == sequence) {
+        uint32_t size = 0;
+        auto pool = deferredBlock_.clone();
+        auto ptr = reinterpret_cast<const cs::Byte*>(pool.to_byte_stream(size));
+        data.assign(ptr, ptr + size);
+        return true;
+    }
+    if (sequence > getLastSeq()) {
+        return false;
+    }
+    return storage_.pool_load_binary(sequence, data);
+}
+
 csdb::Pool BlockChain::loadBlockMeta(const csdb::PoolHash& ph, size_t& cnt) const {
     std::lock_guard lock(dbLock_);
 
@@ -1124,7 +1140,7 @@ std::optional<csdb::Pool> BlockChain::recordBlock(csdb::Pool& pool, bool isTrust
         lastSequence_ = deferredBlock_.sequence();
     }
 
-    csdetails() << kLogPrefix << "Pool #" << deferredBlock_.sequence() << ": " << cs::Utils::byteStreamToHex(deferredBlock_.to_binary().data(), deferredBlock_.to_binary().size());
+    csdetails() << kLogPrefix << "Pool #" << deferredBlock_.sequence() << ": " << cs::Utils::byteStreamToHex(deferredBlock_.binary().data(), deferredBlock_.binary().size());
     emit storeBlockEvent(pool);
     if constexpr (false && (pool.transactions_count() > 0 || pool.sequence() % 10 == 0)) {//log code
         std::string res = printWalletCaches() + "\nTransactions: \n";
@@ -1752,7 +1768,7 @@ namespace {
 
         out << block.transactions_count();
         for (const auto& t : block.transactions()) {
-            out << t.to_byte_stream_for_sig();
+            out << *t.signing_bytes();
         }
 
         const auto& wallets = block.newWallets();
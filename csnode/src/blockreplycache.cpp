@@ -0,0 +1,92 @@
+#include <csnode/blockreplycache.hpp>
+
+namespace cs {
+BlockReplyCache::BlockReplyCache(size_t bytesBudget)
+: bytesBudget_(bytesBudget) {
+}
+
+BlockReplyCache::Reply BlockReplyCache::find(const PoolsRequestedSequences& sequences) {
+    cs::Lock lock(mutex_);
+    auto iter = index_.find(sequences);
+
+    if (iter == index_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+
+    entries_.splice(entries_.begin(), entries_, iter->second);
+
+    ++hits_;
+    savedTime_ += iter->second->cost;
+
+    return iter->second->region;
+}
+
+uint64_t BlockReplyCache::generation() const {
+    cs::Lock lock(mutex_);
+    return generation_;
+}
+
+void BlockReplyCache::insert(const PoolsRequestedSequences& sequences, CompressedRegion region, Duration cost, uint64_t generation) {
+    cs::Lock lock(mutex_);
+
+    if (generation != generation_ || region.size() > bytesBudget_ || index_.find(sequences) != index_.end()) {
+        return;
+    }
+
+    bytes_ += region.size();
+    entries_.push_front(Entry{sequences, std::make_shared<const CompressedRegion>(std::move(region)), cost});
+    index_.emplace(sequences, entries_.begin());
+
+    evict();
+}
+
+void BlockReplyCache::clear() {
+    cs::Lock lock(mutex_);
+
+    index_.clear();
+    entries_.clear();
+    bytes_ = 0;
+    ++generation_;
+}
+
+void BlockReplyCache::onRemoveBlock(const csdb::Pool&) {
+    clear();
+}
+
+size_t BlockReplyCache::bytes() const {
+    cs::Lock lock(mutex_);
+    return bytes_;
+}
+
+size_t BlockReplyCache::hits() const {
+    cs::Lock lock(mutex_);
+    return hits_;
+}
+
+size_t BlockReplyCache::misses() const {
+    cs::Lock lock(mutex_);
+    return misses_;
+}
+
+double BlockReplyCache::hitRatio() const {
+    cs::Lock lock(mutex_);
+    const size_t requests = hits_ + misses_;
+    return requests ? static_cast<double>(hits_) / static_cast<double>(requests) : 0.0;
+}
+
+BlockReplyCache::Duration BlockReplyCache::savedTime() const {
+    cs::Lock lock(mutex_);
+    return savedTime_;
+}
+
+void BlockReplyCache::evict() {
+    while (bytes_ > bytesBudget_) {
+        const Entry& entry = entries_.back();
+
+        bytes_ -= entry.region->size();
+        index_.erase(entry.sequences);
+        entries_.pop_back();
+    }
+}
+}  // namespace cs
@@ -6,6 +6,8 @@
 
 #include <csnode/blockvalidatorplugins.hpp>
 
+#include <lib/system/concurrent.hpp>
+
 namespace cs {
 
 BlockValidator::BlockValidator(Node& node)
@@ -45,12 +47,9 @@ bool BlockValidator::validateBlock(const csdb::Pool& block, ValidationFlags flag
         return false;
     }
 
-    if (!prevBlock_.is_valid() || block.sequence() - prevBlock_.sequence() != 1) {
-        prevBlock_ = bc_.loadBlock(block.previous_hash());
-        if (!prevBlock_.is_valid()) {
-            cserror() << "BlockValidator: block with hash " << block.previous_hash().to_string() << " is not valid.";
-            return false;
-        }
+    prevBlock_ = findPrevBlock(block, prevBlock_);
+    if (!prevBlock_.is_valid()) {
+        return false;
     }
 
     ErrorType validationResult = noError;
@@ -66,4 +65,132 @@ bool BlockValidator::validateBlock(const csdb::Pool& block, ValidationFlags flag
     prevBlock_ = block;
     return true;
 }
+
+size_t BlockValidator::validateBlocks(const std::vector<csdb::Pool>& blocks, ValidationFlags flags, SeverityLevel severity) {
+    if (!flags) {
+        return blocks.size();
+    }
+
+    const auto prevBlocks = findPrevBlocks(blocks, prevBlock_);
+    const size_t count = prevBlocks.size();
+
+    const auto stateless = statelessPlugins(flags);
+    const auto statelessResults = runStateless(blocks, prevBlocks, stateless, severity);
+
+    for (size_t index = 0; index < count; ++index) {
+        const auto& block = blocks[index];
+        if (block.sequence() == 0) {
+            continue;
+        }
+
+        prevBlock_ = prevBlocks[index];
+        size_t statelessIndex = index * stateless.size();
+
+        for (auto& plugin : plugins_) {
+            if (flags & plugin.first) {
+                const ErrorType validationResult = plugin.second->isStateless() ? statelessResults[statelessIndex++] : plugin.second->validateBlock(block);
+                if (!return_(validationResult, severity)) {
+                    return index;
+                }
+            }
+        }
+
+        prevBlock_ = block;
+    }
+
+    return count;
+}
+
+size_t BlockValidator::validateStateless(const std::vector<csdb::Pool>& blocks, ValidationFlags flags, SeverityLevel severity) const {
+    if (!flags) {
+        return blocks.size();
+    }
+
+    const auto prevBlocks = findPrevBlocks(blocks, csdb::Pool{});
+    const auto stateless = statelessPlugins(flags);
+    const auto results = runStateless(blocks, prevBlocks, stateless, severity);
+
+    for (size_t index = 0; index < prevBlocks.size(); ++index) {
+        for (size_t i = 0; i < stateless.size(); ++i) {
+            if (!return_(results[index * stateless.size() + i], severity)) {
+                return index;
+            }
+        }
+    }
+
+    return prevBlocks.size();
+}
+
+std::vector<csdb::Pool> BlockValidator::findPrevBlocks(const std::vector<csdb::Pool>& blocks, const csdb::Pool& candidate) const {
+    std::vector<csdb::Pool> prevBlocks;
+    prevBlocks.reserve(blocks.size());
+
+    for (const auto& block : blocks) {
+        if (block.sequence() == 0) {
+            prevBlocks.emplace_back();
+            continue;
+        }
+
+        if (!block.is_valid()) {
+            cserror() << "BlockValidator: invalid block received";
+            break;
+        }
+
+        auto prevBlock = findPrevBlock(block, prevBlocks.empty() ? candidate : blocks[prevBlocks.size() - 1]);
+        if (!prevBlock.is_valid()) {
+            break;
+        }
+
+        prevBlocks.push_back(std::move(prevBlock));
+    }
+
+    return prevBlocks;
+}
+
+std::vector<StatelessValidationPlugin*> BlockValidator::statelessPlugins(ValidationFlags flags) const {
+    std::vector<StatelessValidationPlugin*> stateless;
+
+    for (auto& plugin : plugins_) {
+        if ((flags & plugin.first) && plugin.second->isStateless()) {
+            stateless.push_back(static_cast<StatelessValidationPlugin*>(plugin.second.get()));
+        }
+    }
+
+    return stateless;
+}
+
+std::vector<BlockValidator::ErrorType> BlockValidator::runStateless(const std::vector<csdb::Pool>& blocks, const std::vector<csdb::Pool>& prevBlocks,
+                                                                    const std::vector<StatelessValidationPlugin*>& stateless, SeverityLevel severity) {
+    std::vector<ErrorType> results(prevBlocks.size() * stateless.size(), noError);
+
+    cs::Concurrent::parallelFor(prevBlocks.size(), 1, [&](size_t index) {
+        if (blocks[index].sequence() == 0) {
+            return;
+        }
+
+        for (size_t i = 0; i < stateless.size(); ++i) {
+            auto& result = results[index * stateless.size() + i];
+            result = stateless[i]->validateBlock(blocks[index], prevBlocks[index]);
+
+            if (!return_(result, severity)) {
+                break;
+            }
+        }
+    });
+
+    return results;
+}
+
+csdb::Pool BlockValidator::findPrevBlock(const csdb::Pool& block, const csdb::Pool& candidate) const {
+    if (candidate.is_valid() && block.sequence() - candidate.sequence() == 1) {
+        return candidate;
+    }
+
+    auto prevBlock = bc_.loadBlock(block.previous_hash());
+    if (!prevBlock.is_valid()) {
+        cserror() << "BlockValidator: block with hash " << block.previous_hash().to_string() << " is not valid.";
+    }
+
+    return prevBlock;
+}
 }  // namespace cs
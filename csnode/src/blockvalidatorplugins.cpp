@@ -147,11 +147,10 @@ bool SmartStateValidator::checkNewState(const csdb::Transaction& t) {
     return true;
 }
 
-ValidationPlugin::ErrorType HashValidator::validateBlock(const csdb::Pool& block) {
+ValidationPlugin::ErrorType HashValidator::validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) {
   auto prevHash = block.previous_hash();
-  auto& prevBlock = getPrevBlock();
-  
-  auto data = prevBlock.to_binary();
+
+  const auto& data = prevBlock.binary();
   auto countedPrevHash = csdb::PoolHash::calc_from_data(cs::Bytes(data.data(),
                                                           data.data() +
                                                           prevBlock.hashingLength()));
@@ -163,8 +162,7 @@ ValidationPlugin::ErrorType HashValidator::validateBlock(const csdb::Pool& block
   return ErrorType::noError;
 }
 
-ValidationPlugin::ErrorType BlockNumValidator::validateBlock(const csdb::Pool& block) {
-  auto& prevBlock = getPrevBlock();
+ValidationPlugin::ErrorType BlockNumValidator::validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) {
   if (block.sequence() - prevBlock.sequence() != kGapBtwNeighbourBlocks) {
     cserror() << kLogPrefix << "Current block's sequence is " << block.sequence()
               << ", previous block sequence is " << prevBlock.sequence();
@@ -173,9 +171,7 @@ ValidationPlugin::ErrorType BlockNumValidator::validateBlock(const csdb::Pool& b
   return ErrorType::noError;
 }
 
-ValidationPlugin::ErrorType TimestampValidator::validateBlock(const csdb::Pool& block) {
-  auto& prevBlock = getPrevBlock();
-
+ValidationPlugin::ErrorType TimestampValidator::validateBlock(const csdb::Pool& block, const csdb::Pool& prevBlock) {
   auto prevBlockTimestampUf = prevBlock.user_field(kTimeStampUserFieldNum);
   if (!prevBlockTimestampUf.is_valid()) {
     cswarning() << kLogPrefix << "Block with sequence " << prevBlock.sequence() << " has no timestamp";
@@ -199,7 +195,7 @@ ValidationPlugin::ErrorType TimestampValidator::validateBlock(const csdb::Pool&
   return ErrorType::noError;
 }
 
-ValidationPlugin::ErrorType BlockSignaturesValidator::validateBlock(const csdb::Pool& block) {
+ValidationPlugin::ErrorType BlockSignaturesValidator::validateBlock(const csdb::Pool& block, const csdb::Pool&) {
   uint64_t realTrustedMask = block.realTrusted();
 #ifdef _MSC_VER
   size_t numOfRealTrusted = static_cast<decltype(numOfRealTrusted)>(__popcnt64(realTrustedMask));
@@ -225,21 +221,29 @@ ValidationPlugin::ErrorType BlockSignaturesValidator::validateBlock(const csdb::
   }
 
   size_t checkingSignature = 0;
-  auto signedData = cscrypto::calculateHash(block.to_binary().data(), block.hashingLength());
+  // pool hash is calculated over the same signed part of the composed binary
+  const auto signedData = std::make_shared<const cs::Bytes>(block.hash().to_binary());
+  if (signedData->size() != cscrypto::kHashSize) {
+    cserror() << kLogPrefix << "block " << block.sequence() << " is not composed";
+    return ErrorType::error;
+  }
+
+  // memoized, so the block store checks the same signatures without verification
+  SignatureVerifier::Batch batch;
+  batch.reserve(signatures.size());
   for (size_t i = 0; i < confidants.size(); ++i) {
     if (realTrustedMask & (1ull << i)) {
-      if (!cscrypto::verifySignature(signatures[checkingSignature],
-                                     confidants[i],
-                                     signedData.data(),
-                                     cscrypto::kHashSize)) {
-        cserror() << kLogPrefix << "block " << block.sequence()
-                  << " has invalid signatures";
-        return ErrorType::error;
-      }
+      batch.push_back(SignatureVerifier::Entry{signedData, confidants[i], signatures[checkingSignature], true});
       ++checkingSignature;
     }
   }
 
+  if (!SignatureVerifier::verifyAll(batch)) {
+    cserror() << kLogPrefix << "block " << block.sequence()
+              << " has invalid signatures";
+    return ErrorType::error;
+  }
+
   return ErrorType::noError;
 }
 
@@ -385,7 +389,7 @@ ValidationPlugin::ErrorType BalanceOnlyChecker::validateBlock(const csdb::Pool&
     csdebug() << kLogPrefix << ": checking Block";
     auto prevHash = pool.previous_hash();
     auto prevBlock = getBlockChain().getLastBlock();
-    auto data = prevBlock.to_binary();
+    const auto& data = prevBlock.binary();
     auto countedPrevHash = csdb::PoolHash::calc_from_data(cs::Bytes(data.data(),
         data.data() +
         prevBlock.hashingLength()));
@@ -414,7 +418,11 @@ ValidationPlugin::ErrorType BalanceOnlyChecker::validateBlock(const csdb::Pool&
 ValidationPlugin::ErrorType TransactionsChecker::validateBlock(const csdb::Pool& block) {
   const auto& trxs = block.transactions();
   std::set<csdb::Address> newStates;
-  for (const auto& t : trxs) {
+  std::vector<size_t> checkedIndexes;
+  SignatureVerifier::Batch batch;
+
+  for (size_t i = 0; i < trxs.size(); ++i) {
+    const auto& t = trxs[i];
     if (SmartContracts::is_new_state(t)) {
       // already checked by another plugin
       newStates.insert(t.source());
@@ -426,7 +434,15 @@ ValidationPlugin::ErrorType TransactionsChecker::validateBlock(const csdb::Pool&
       continue;
     }
 
-    if (!checkSignature(t)) {
+    batch.push_back(makeSignatureEntry(t));
+    checkedIndexes.push_back(i);
+  }
+
+  const auto results = SignatureVerifier::verify(batch);
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (!results[i]) {
+      const auto& t = trxs[checkedIndexes[i]];
       cserror() << kLogPrefix << " in pool " << block.sequence()
                 << " transaction from " << t.source().to_string()
                 << ", with innerID " << t.innerID()
@@ -437,13 +453,13 @@ ValidationPlugin::ErrorType TransactionsChecker::validateBlock(const csdb::Pool&
   return ErrorType::noError;
 }
 
-bool TransactionsChecker::checkSignature(const csdb::Transaction& t) {
+SignatureVerifier::Entry TransactionsChecker::makeSignatureEntry(const csdb::Transaction& t) {
   if (t.source().is_wallet_id()) {
     const auto& bc = getBlockChain();
     auto pub = bc.getAddressByType(t.source(), BlockChain::AddressType::PublicKey);
-    return t.verify_signature(pub.public_key());
+    return SignatureVerifier::makeEntry(t, pub.public_key());
   } else {
-    return t.verify_signature(t.source().public_key());
+    return SignatureVerifier::makeEntry(t, t.source().public_key());
   }
 }
 
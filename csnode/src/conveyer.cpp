@@ -1,5 +1,6 @@
 #include "csnode/conveyer.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <iomanip>
 
@@ -111,6 +112,28 @@ void cs::ConveyerBase::addTransaction(const csdb::Transaction& transaction) {
     }
 }
 
+std::vector<cs::PacketQueue::PushResult> cs::ConveyerBase::addTransactions(const std::vector<csdb::Transaction>& transactions) {
+    if (transactions.empty()) {
+        return {};
+    }
+
+    cs::Lock lock(sharedMutex_);
+    auto results = pimpl_->packetQueue.push(transactions);
+
+    const auto count = static_cast<size_t>(std::count(results.begin(), results.end(), cs::PacketQueue::PushResult::Pushed));
+    const auto duplicates = static_cast<size_t>(std::count(results.begin(), results.end(), cs::PacketQueue::PushResult::Duplicate));
+
+    if (count == transactions.size()) {
+        csdetails() << csname() << "Add " << count << " valid transactions to conveyer, queue size: " << pimpl_->packetQueue.size();
+    }
+    else {
+        cswarning() << csname() << "Add transactions partially failed, added " << count << " of " << transactions.size()
+                    << ", duplicates " << duplicates << ", queue size: " << pimpl_->packetQueue.size();
+    }
+
+    return results;
+}
+
 void cs::ConveyerBase::addContractPacket(cs::TransactionsPacket& packet) {
     cs::TransactionsPacketHash hash = packet.hash();
     csdebug() << csname() << "Add separate transactions packet to conveyer, transactions " << packet.transactionsCount();
@@ -126,6 +149,10 @@ void cs::ConveyerBase::addContractPacket(cs::TransactionsPacket& packet) {
 }
 
 void cs::ConveyerBase::addTransactionsPacket(const cs::TransactionsPacket& packet) {
+    addTransactionsPacket(cs::TransactionsPacket(packet));
+}
+
+void cs::ConveyerBase::addTransactionsPacket(cs::TransactionsPacket&& packet) {
     auto round = currentRoundNumber();
 
     if (round > packet.expiredRound()) {
@@ -137,8 +164,8 @@ void cs::ConveyerBase::addTransactionsPacket(const cs::TransactionsPacket& packe
     cs::TransactionsPacketHash hash = packet.hash();
     cs::Lock lock(sharedMutex_);
 
-    if (!isPacketAtCache(packet)) {
-        pimpl_->packetsTable.emplace(std::move(hash), packet);
+    if (!isPacketAtCache(hash)) {
+        pimpl_->packetsTable.emplace(std::move(hash), cs::TransactionsPacket::share(std::move(packet)));
     }
     else {
         csdebug() << csname() << "Same hash already exists at table: " << hash.toString();
@@ -179,11 +206,11 @@ std::optional<std::pair<cs::TransactionsPacket, cs::PacketsVector>> cs::Conveyer
         }
 
         // to smarts
-        if (iterator->second.signatures().size() > smartContractDetector) {
-            smartContractPackets.push_back(iterator->second);
+        if (iterator->second->signatures().size() > smartContractDetector) {
+            smartContractPackets.push_back(*iterator->second);
         }
 
-        const auto& transactions = iterator->second.transactions();
+        const auto& transactions = iterator->second->transactions();
 
         for (const auto& transaction : transactions) {
             if (!packet.addTransaction(transaction)) {
@@ -362,7 +389,7 @@ void cs::ConveyerBase::addFoundPacket(cs::RoundNumber round, cs::TransactionsPac
 
         // add to current table
         auto hash = packet.hash();
-        tablePointer->emplace(std::move(hash), std::move(packet));
+        tablePointer->emplace(std::move(hash), cs::TransactionsPacket::share(std::move(packet)));
     }
 }
 
@@ -471,19 +498,18 @@ std::optional<csdb::Pool> cs::ConveyerBase::applyCharacteristic(const cs::PoolMe
 
     for (const auto& hash : localHashes) {
         // try to get from meta if can
-        auto optionalPacket = findPacket(hash, round);
+        cs::TransactionsPacketPtr packet = findPacket(hash, round);
 
-        if (!optionalPacket.has_value()) {
+        if (!packet) {
             csmeta(cserror) << "hash not found " << hash.toString() << ", strange behaviour detected";
             removeHashesFromTable(localHashes);
             return std::nullopt;
         }
 
-        auto packet = std::move(optionalPacket).value();
-        const auto& transactions = packet.transactions();
+        const auto& transactions = packet->transactions();
 
         // first look at signatures if it is smarts packet
-        if (packet.isSmart()) {
+        if (packet->isSmart()) {
             const auto& stateTransaction = transactions.front();
 
             // check range
@@ -501,7 +527,7 @@ std::optional<csdb::Pool> cs::ConveyerBase::applyCharacteristic(const cs::PoolMe
                     }
 
                     smartSignatures.smartKey = stateTransaction.source().public_key();
-                    smartSignatures.signatures = packet.signatures();
+                    smartSignatures.signatures = packet->signatures();
 
                     newPool.add_smart_signature(smartSignatures);
                 }
@@ -512,7 +538,7 @@ std::optional<csdb::Pool> cs::ConveyerBase::applyCharacteristic(const cs::PoolMe
 
             // add states to cache
             if (!isStateRejected) {
-                for (const auto& transaction : packet.stateTransactions()) {
+                for (const auto& transaction : packet->stateTransactions()) {
                     stateTransactions.push_back(transaction);
                 }
             }
@@ -577,7 +603,7 @@ std::optional<csdb::Pool> cs::ConveyerBase::applyCharacteristic(const cs::PoolMe
     return std::make_optional<csdb::Pool>(std::move(newPool));
 }
 
-std::optional<cs::TransactionsPacket> cs::ConveyerBase::findPacket(const cs::TransactionsPacketHash& hash, const RoundNumber round) const {
+cs::TransactionsPacketPtr cs::ConveyerBase::findPacket(const cs::TransactionsPacketHash& hash, const RoundNumber round) const {
     if (auto iterator = pimpl_->packetsTable.find(hash); iterator != pimpl_->packetsTable.end()) {
         return iterator->second;
     }
@@ -585,7 +611,7 @@ std::optional<cs::TransactionsPacket> cs::ConveyerBase::findPacket(const cs::Tra
     cs::ConveyerMeta* meta = pimpl_->metaStorage.get(round);
 
     if (!meta) {
-        return std::nullopt;
+        return nullptr;
     }
 
     const auto& value = meta->hashTable;
@@ -594,7 +620,7 @@ std::optional<cs::TransactionsPacket> cs::ConveyerBase::findPacket(const cs::Tra
         return iter->second;
     }
 
-    return std::nullopt;
+    return nullptr;
 }
 
 bool cs::ConveyerBase::isMetaTransactionInvalid(int64_t id) {
@@ -616,16 +642,7 @@ bool cs::ConveyerBase::isMetaTransactionInvalid(int64_t id) {
 
 size_t cs::ConveyerBase::packetQueueTransactionsCount() const {
     cs::SharedLock lock(sharedMutex_);
-    size_t count = 0;
-
-    auto begin = pimpl_->packetQueue.begin();
-    auto end = pimpl_->packetQueue.end();
-
-    std::for_each(begin, end, [&](const auto& packet) {
-        count += packet.transactionsCount();
-    });
-
-    return count;
+    return pimpl_->packetQueue.transactionsCount();
 }
 
 size_t cs::ConveyerBase::packetsTableSize() const {
@@ -666,19 +683,19 @@ void cs::ConveyerBase::flushTransactions() {
 
             emit packetFlushed(packet);
 
-            addPacketToMeta(packet);
+            addPacketToMeta(std::move(packet));
         }
     }
 }
 
 void cs::ConveyerBase::onRoundChanged(cs::RoundNumber round) {
-    cs::PacketsVector expiredPackets;
+    cs::SharedPacketsVector expiredPackets;
 
     {
         cs::SharedLock lock(sharedMutex_);
 
         for (const auto& element : pimpl_->packetsTable) {
-            if (element.second.expiredRound() < round) {
+            if (element.second->expiredRound() < round) {
                 expiredPackets.push_back(element.second);
             }
         }
@@ -692,20 +709,20 @@ void cs::ConveyerBase::onRoundChanged(cs::RoundNumber round) {
         cs::Lock lock(sharedMutex_);
 
         for (const auto& packet : expiredPackets) {
-            const auto& hash = packet.hash();
+            const auto& hash = packet->hash();
 
             pimpl_->packetsTable.erase(hash);
 
-            emit packetExpired(packet);
+            emit packetExpired(*packet);
         }
     }
 }
 
-void cs::ConveyerBase::addPacketToMeta(cs::TransactionsPacket& packet) {
+void cs::ConveyerBase::addPacketToMeta(cs::TransactionsPacket&& packet) {
     auto hash = packet.hash();
 
-    if (!isPacketAtCache(packet)) {
-        pimpl_->packetsTable.emplace(std::move(hash), std::move(packet));
+    if (!isPacketAtCache(hash)) {
+        pimpl_->packetsTable.emplace(std::move(hash), cs::TransactionsPacket::share(std::move(packet)));
     }
     else {
         csdebug() << csname() << "Same transaction packet already in packet table " << hash.toString();
@@ -720,7 +737,7 @@ void cs::ConveyerBase::changeRound(cs::RoundNumber round) {
     }
 }
 
-std::optional<cs::TransactionsPacket> cs::ConveyerBase::findPacketAtMeta(const cs::TransactionsPacketHash& hash) const {
+cs::TransactionsPacketPtr cs::ConveyerBase::findPacketAtMeta(const cs::TransactionsPacketHash& hash) const {
     auto iter = pimpl_->packetsTable.find(hash);
 
     if (iter != pimpl_->packetsTable.end()) {
@@ -735,7 +752,7 @@ std::optional<cs::TransactionsPacket> cs::ConveyerBase::findPacketAtMeta(const c
         }
     }
 
-    return std::nullopt;
+    return nullptr;
 }
 
 void cs::ConveyerBase::removeHashesFromTable(const cs::PacketsHashes& hashes) {
@@ -759,8 +776,7 @@ cs::TransactionsPacketTable& cs::ConveyerBase::poolTable(cs::RoundNumber round)
     return pimpl_->packetsTable;
 }
 
-bool cs::ConveyerBase::isPacketAtCache(const cs::TransactionsPacket& packet) {
-    auto hash = packet.hash();
+bool cs::ConveyerBase::isPacketAtCache(const cs::TransactionsPacketHash& hash) {
     auto iter = pimpl_->packetsTable.find(hash);
 
     if (iter != pimpl_->packetsTable.end()) {
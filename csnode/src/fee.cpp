@@ -44,7 +44,7 @@ csdb::AmountCommission getFee(const csdb::Transaction& t) {
         return csdb::AmountCommission(minFee());
     }
 
-    size_t size = t.to_byte_stream().size();
+    size_t size = t.byte_stream_size();
 
     if (!SmartContracts::is_smart_contract(t) && size <= kCommonTrSize) {
         return csdb::AmountCommission(minFee());
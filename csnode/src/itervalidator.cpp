@@ -4,6 +4,7 @@
 
 #include <csdb/amount_commission.hpp>
 #include <csnode/fee.hpp>
+#include <csnode/signatureverifier.hpp>
 #include <csnode/walletsstate.hpp>
 #include <smartcontracts.hpp>
 #include <solvercontext.hpp>
@@ -177,28 +178,52 @@ Reject::Reason IterValidator::deployAdditionalCheck(SolverContext& context, size
 
 void IterValidator::checkTransactionsSignatures(SolverContext& context, const Transactions& transactions, cs::Bytes& characteristicMask, PacketsVector& smartsPackets) {
     checkSignaturesSmartSource(context, smartsPackets);
-    size_t transactionsCount = transactions.size();
-    size_t maskSize = characteristicMask.size();
+    const size_t count = std::min(transactions.size(), characteristicMask.size());
     size_t rejectedCounter = 0;
-    for (size_t i = 0; i < transactionsCount; ++i) {
-        if (i < maskSize) {
-            bool correctSignature = checkTransactionSignature(context, transactions[i]);
-            if (!correctSignature) {
-                characteristicMask[i] = Reject::Reason::WrongSignature;
-                rejectedCounter++;
-                cslog() << kLogPrefix << "transaction[" << i << "] rejected, incorrect signature.";
-                if (SmartContracts::is_new_state(transactions[i])) {
-                    pTransval_->saveNewState(context.smart_contracts().absolute_address(transactions[i].source()), i, Reject::Reason::WrongSignature);
-                }
+
+    auto reject = [&](size_t i) {
+        characteristicMask[i] = Reject::Reason::WrongSignature;
+        rejectedCounter++;
+        cslog() << kLogPrefix << "transaction[" << i << "] rejected, incorrect signature.";
+        if (SmartContracts::is_new_state(transactions[i])) {
+            pTransval_->saveNewState(context.smart_contracts().absolute_address(transactions[i].source()), i, Reject::Reason::WrongSignature);
+        }
+    };
+
+    SignatureVerifier::Batch batch;
+    std::vector<size_t> batchIndexes;
+
+    batch.reserve(count);
+    batchIndexes.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        cs::PublicKey key;
+
+        if (auto result = checkTransactionSignature(context, transactions[i], key); result.has_value()) {
+            if (!result.value()) {
+                reject(i);
             }
         }
+        else {
+            batch.push_back(SignatureVerifier::makeEntry(transactions[i], key));
+            batchIndexes.push_back(i);
+        }
+    }
+
+    const auto results = SignatureVerifier::verify(batch);
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (!results[i]) {
+            reject(batchIndexes[i]);
+        }
     }
+
     if (rejectedCounter) {
         cslog() << kLogPrefix << "wrong signatures num: " << rejectedCounter;
     }
 }
 
-bool IterValidator::checkTransactionSignature(SolverContext& context, const csdb::Transaction& transaction) {
+std::optional<bool> IterValidator::checkTransactionSignature(SolverContext& context, const csdb::Transaction& transaction, cs::PublicKey& key) {
     csdb::Address src = transaction.source();
     // TODO: is_known_smart_contract() does not recognize not yet deployed contract, so all transactions emitted in constructor
     // currently will be rejected
@@ -216,7 +241,8 @@ bool IterValidator::checkTransactionSignature(SolverContext& context, const csdb
                     return false;
                 }
             }
-            return transaction.verify_signature(pub.public_key());
+            key = pub.public_key();
+            return std::nullopt;
         }
         if (context.blockchain().isSpecial(transaction)) {
             const auto& starter_key = cs::PacketValidator::getBlockChainKey();
@@ -224,7 +250,8 @@ bool IterValidator::checkTransactionSignature(SolverContext& context, const csdb
                 return false;
             }
         }
-        return transaction.verify_signature(src.public_key());
+        key = src.public_key();
+        return std::nullopt;
     }
     else {
         // special rule for new_state transactions
@@ -244,6 +271,18 @@ bool IterValidator::checkTransactionSignature(SolverContext& context, const csdb
 void IterValidator::checkSignaturesSmartSource(SolverContext& context, cs::PacketsVector& smartContractsPackets) {
     smartSourceInvalidSignatures_.clear();
 
+    // signatures of all packets are verified by single batch
+    struct PacketSignatures {
+        const cs::TransactionsPacket* packet;
+        size_t confidantsCount;
+        size_t begin;
+        size_t end;
+    };
+
+    std::vector<PacketSignatures> packetsSignatures;
+    std::vector<cs::Byte> signers;
+    SignatureVerifier::Batch batch;
+
     for (auto& smartContractPacket : smartContractsPackets) {
         if (smartContractPacket.transactions().size() > 0) {
             smartContractPacket.makeHash();
@@ -270,25 +309,36 @@ void IterValidator::checkSignaturesSmartSource(SolverContext& context, cs::Packe
             //csdebug() << kLogPrefix << "Pack expired round = " << smartContractPacket.expiredRound();
             const auto& confidants = poolWithInitTr.confidants();
             const auto& signatures = smartContractPacket.signatures();
-            const cs::Byte* signedHash = smartContractPacket.hash().toBinary().data();
-            size_t correctSignaturesCounter = 0;
-            std::string invalidSignatures;
+            const auto signedHash = std::make_shared<const cs::Bytes>(smartContractPacket.hash().toBinary());
+            PacketSignatures packetSignatures{&smartContractPacket, confidants.size(), batch.size(), batch.size()};
             for (const auto& signature : signatures) {
                 if (signature.first < confidants.size()) {
-                    const auto& confidantPublicKey = confidants[signature.first];
-                    //csdebug() << "Hash (" << static_cast<int>(signature.first) << "): " << cs::Utils::byteStreamToHex(signedHash, cscrypto::kHashSize) << " - " << smartContractPacket.hash().toString();
-                    if (cscrypto::verifySignature(signature.second, confidantPublicKey, signedHash, cscrypto::kHashSize)) {
-                        ++correctSignaturesCounter;
-                    }
-                    else {
-                        invalidSignatures += (std::to_string(static_cast<int>(signature.first)) + ", ");
-                    }
+                    batch.push_back(SignatureVerifier::Entry{signedHash, confidants[signature.first], signature.second});
+                    signers.push_back(signature.first);
                 }
             }
-            if (correctSignaturesCounter < confidants.size() / 2U + 1U) {
-                csdebug() << kLogPrefix << "is not enough valid signatures, bad ones: " << invalidSignatures << " packet hash: " << smartContractPacket.hash().toString();
-                smartSourceInvalidSignatures_.insert(transaction.source());
+            packetSignatures.end = batch.size();
+            packetsSignatures.push_back(packetSignatures);
+        }
+    }
+
+    const auto results = SignatureVerifier::verify(batch);
+
+    for (const auto& packetSignatures : packetsSignatures) {
+        size_t correctSignaturesCounter = 0;
+        std::string invalidSignatures;
+        for (size_t i = packetSignatures.begin; i < packetSignatures.end; ++i) {
+            if (results[i]) {
+                ++correctSignaturesCounter;
             }
+            else {
+                invalidSignatures += (std::to_string(static_cast<int>(signers[i])) + ", ");
+            }
+        }
+        if (correctSignaturesCounter < packetSignatures.confidantsCount / 2U + 1U) {
+            const auto& packet = *packetSignatures.packet;
+            csdebug() << kLogPrefix << "is not enough valid signatures, bad ones: " << invalidSignatures << " packet hash: " << packet.hash().toString();
+            smartSourceInvalidSignatures_.insert(packet.transactions()[0].source());
         }
     }
 }
@@ -330,7 +380,8 @@ std::string IterValidator::SimpleValidator::getRejectMessage(RejectCode rc) {
     }
 }
 
-bool IterValidator::SimpleValidator::validate(const csdb::Transaction& t, const BlockChain& bc, SmartContracts& sc, csdb::AmountCommission* countedFeePtr, RejectCode* rcPtr) {
+bool IterValidator::SimpleValidator::validate(const csdb::Transaction& t, const BlockChain& bc, SmartContracts& sc, csdb::AmountCommission* countedFeePtr, RejectCode* rcPtr,
+                                              bool checkSignature) {
     RejectCode rc = kAllCorrect;
 
     BlockChain::WalletData sWallet;
@@ -436,11 +487,11 @@ bool IterValidator::SimpleValidator::validate(const csdb::Transaction& t, const
         rc = kInsufficientBalance;
     }
 
-    if (!rc && t.to_byte_stream().size() > Consensus::MaxTransactionSize) {
+    if (!rc && t.byte_stream_size() > Consensus::MaxTransactionSize) {
         rc = kTooLarge;
     }
 
-    if (!rc && !t.verify_signature(bc.getAddressByType(t.source(), BlockChain::AddressType::PublicKey).public_key())) {
+    if (!rc && checkSignature && !SignatureVerifier::verify(SignatureVerifier::makeEntry(t, bc.getAddressByType(t.source(), BlockChain::AddressType::PublicKey).public_key()))) {
         rc = kWrongSignature;
     }
 
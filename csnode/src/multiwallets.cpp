@@ -35,7 +35,7 @@ uint64_t cs::MultiWallets::createTime(const cs::PublicKey& key) const {
 }
 #endif
 
-void cs::MultiWallets::onDbReadFinished(const std::unordered_map<cs::PublicKey, cs::WalletsCache::WalletData>& data) {
+void cs::MultiWallets::onDbReadFinished(const cs::WalletsCache::Wallets& data) {
     cs::Lock lock(mutex_);
 
     for (const auto& [key, value] : data) {
@@ -20,6 +20,9 @@
 #include <csnode/roundpackage.hpp>
 #include <csnode/configholder.hpp>
 #include <csnode/eventreport.hpp>
+#include <csnode/signatureverifier.hpp>
+#include <csnode/signaturescache.hpp>
+#include <csnode/startupvalidator.hpp>
 
 #include <lib/system/logger.hpp>
 #include <lib/system/progressbar.hpp>
@@ -83,7 +86,11 @@ Node::Node(cs::config::Observer& observer)
 
     // it should work prior WalletsIds & WalletsCache on reading DB
     // to prevent slow BCh reading skip deep validation of already validated blocks
-    //cs::Connector::connect(&blockChain_.readBlockEvent(), this, &Node::deepBlockValidation);
+    if (cs::ConfigHolder::instance().config()->deepValidation()) {
+        startupValidator_ = std::make_unique<cs::StartupValidator>(*blockValidator_, cs::ConfigHolder::instance().config()->getPathToDB());
+        cs::Connector::connect(&blockChain_.startReadingBlocksEvent(), startupValidator_.get(), &cs::StartupValidator::onStartReading);
+        cs::Connector::connect(&blockChain_.readBlockEvent(), this, &Node::deepValidateReadBlock);
+    }
     // let blockChain_ to subscribe on signals, WalletsIds & WalletsCache are there
     blockChain_.subscribeToSignals();
     // solver MUST subscribe to signals after the BlockChain
@@ -104,6 +111,7 @@ Node::Node(cs::config::Observer& observer)
     cs::Connector::connect(&blockChain_.tryToStoreBlockEvent, this, &Node::deepBlockValidation);
     cs::Connector::connect(&blockChain_.storeBlockEvent, this, &Node::processSpecialInfo);
     cs::Connector::connect(&blockChain_.uncertainBlock, this, &Node::sendBlockRequestToConfidants);
+    cs::Connector::connect(&blockChain_.removeBlockEvent, &blockReplyCache_, &cs::BlockReplyCache::onRemoveBlock);
 
     initPoolSynchronizer();
     setupNextMessageBehaviour();
@@ -209,6 +217,7 @@ void Node::initPoolSynchronizer() {
     cs::Connector::connect(&transport_->pingReceived, poolSynchronizer_, &cs::PoolSynchronizer::onPingReceived);
     cs::Connector::connect(&transport_->neighbourAdded, poolSynchronizer_, &cs::PoolSynchronizer::onNeighbourAdded);
     cs::Connector::connect(&transport_->neighbourRemoved, poolSynchronizer_, &cs::PoolSynchronizer::onNeighbourRemoved);
+    cs::Connector::connect(&transport_->neighbourRttUpdated, poolSynchronizer_, &cs::PoolSynchronizer::onNeighbourRttUpdated);
 }
 
 void Node::setupNextMessageBehaviour() {
@@ -518,8 +527,20 @@ bool Node::verifyPacketTransactions(cs::TransactionsPacket packet, const cs::Pub
 
     if (packet.signatures().size() == 1) {
         auto& transactions = packet.transactions();
+        auto& blockChain = getBlockChain();
+
+        cs::SignatureVerifier::Batch batch;
+        batch.reserve(transactions.size());
+
         for (auto& it : transactions) {
-            if (cs::IterValidator::SimpleValidator::validate(it, getBlockChain(), solver_->smart_contracts())) {
+            const auto source = blockChain.getAddressByType(it.source(), BlockChain::AddressType::PublicKey);
+            batch.push_back(cs::SignatureVerifier::makeEntry(it, source.public_key()));
+        }
+
+        const auto signatures = cs::SignatureVerifier::verify(batch);
+
+        for (size_t i = 0; i < transactions.size(); ++i) {
+            if (signatures[i] && cs::IterValidator::SimpleValidator::validate(transactions[i], blockChain, solver_->smart_contracts(), nullptr, nullptr, false)) {
                 ++sum;
             }
         }
@@ -1268,6 +1289,11 @@ void Node::sendPacketHashesRequest(const cs::PacketsHashes& hashes, const cs::Ro
     if (transport_->getNeighboursCount() == 0) {
         cswarning() << csname() << "Can not send packet hashes to neighbours: no neighbours";
     }
+    else if (requestStep == startPacketRequestPoint_) {
+        for (const auto& neighbour : transport_->getBestNeighbours(kPacketRequestRelays_)) {
+            sendDirect(neighbour, MsgTypes::TransactionsPacketRequest, round, hashes);
+        }
+    }
     else {
         transport_->forEachNeighbour([this, round, &hashes](const cs::PublicKey& neighbour, cs::Sequence, cs::RoundNumber) {
                                         sendDirect(neighbour, MsgTypes::TransactionsPacketRequest, round, hashes);
@@ -1290,7 +1316,7 @@ void Node::sendPacketHashesRequest(const cs::PacketsHashes& hashes, const cs::Ro
 }
 
 
-void Node::sendPacketHashesReply(const cs::PacketsVector& packets, const cs::RoundNumber round, const cs::PublicKey& target) {
+void Node::sendPacketHashesReply(const cs::SharedPacketsVector& packets, const cs::RoundNumber round, const cs::PublicKey& target) {
     if (packets.empty()) {
         return;
     }
@@ -1319,31 +1345,50 @@ void Node::getBlockRequest(const uint8_t* data, const size_t size, const cs::Pub
         return;
     }
 
-    const std::size_t reserveSize = sequences.size();
+    sendBlockReply(sequences, sender);
+}
+
+void Node::getBlockReply(const uint8_t* data, const size_t size, const cs::PublicKey& sender) {
+    getBlockReply(prepareBlockReply(data, size), sender);
+}
 
-    cs::PoolsBlock poolsBlock;
-    poolsBlock.reserve(reserveSize);
+Node::SyncedBlocks Node::prepareBlockReply(const uint8_t* data, const size_t size) {
+    SyncedBlocks syncedBlocks;
 
-    auto sendReply = [&] {
-        sendBlockReply(poolsBlock, sender);
-        poolsBlock.clear();
-    };
+    cs::IDataStream stream(data, size);
+
+    cs::CompressedRegion region;
+    stream >> region;
 
-    for (auto& sequence : sequences) {
-        csdb::Pool pool = blockChain_.loadBlock(sequence);
+    syncedBlocks.blocks = compressor_.decompress<cs::PoolsBlock>(region);
 
-        if (pool.is_valid()) {
-            poolsBlock.push_back(std::move(pool));
-        }
-        else {
-            csmeta(cslog) << "unable to load block " << sequence << " from blockchain";
+    const auto& blocks = syncedBlocks.blocks;
+    if (blocks.empty()) {
+        return syncedBlocks;
+    }
+
+    // only the reply continuing own chain is checked ahead, any other goes to store as is
+    syncedBlocks.lastHash = blockChain_.getLastHash();
+
+    if (blocks.front().sequence() != blockChain_.getLastSeq() + 1 || blocks.front().previous_hash() != syncedBlocks.lastHash) {
+        return syncedBlocks;
+    }
+
+    for (size_t i = 1; i < blocks.size(); ++i) {
+        if (blocks[i].sequence() != blocks[i - 1].sequence() + 1) {
+            return syncedBlocks;
         }
     }
 
-    sendReply();
+    syncedBlocks.validCount = blockValidator_->validateStateless(blocks,
+        cs::BlockValidator::ValidationLevel::hashIntergrity |
+        cs::BlockValidator::ValidationLevel::blockNum |
+        cs::BlockValidator::ValidationLevel::blockSignatures);
+
+    return syncedBlocks;
 }
 
-void Node::getBlockReply(const uint8_t* data, const size_t size) {
+void Node::getBlockReply(SyncedBlocks&& syncedBlocks, const cs::PublicKey& sender) {
     bool isSyncOn = poolSynchronizer_->isSyncroStarted();
     bool isBlockchainUncertain = blockChain_.isLastBlockUncertain();
 
@@ -1354,12 +1399,7 @@ void Node::getBlockReply(const uint8_t* data, const size_t size) {
 
     csdebug() << "NODE> Get Block Reply";
 
-    cs::IDataStream stream(data, size);
-
-    cs::CompressedRegion region;
-    stream >> region;
-
-    cs::PoolsBlock poolsBlock = compressor_.decompress<cs::PoolsBlock>(region);
+    auto& poolsBlock = syncedBlocks.blocks;
 
     if (poolsBlock.empty()) {
         cserror() << "NODE> Get block reply> No pools found";
@@ -1378,27 +1418,76 @@ void Node::getBlockReply(const uint8_t* data, const size_t size) {
     }
 
     if (isSyncOn) {
-        poolSynchronizer_->getBlockReply(std::move(poolsBlock));
+        // the check holds while own chain is the one the blocks were checked against,
+        // invalid block itself is stored as usual to be reported and rolled back, the following ones are dropped
+        const auto validCount = syncedBlocks.validCount;
+
+        if (validCount && *validCount + 1 < poolsBlock.size() && syncedBlocks.lastHash == blockChain_.getLastHash()) {
+            csdebug() << "NODE> Get block reply> drop " << poolsBlock.size() - *validCount - 1 << " blocks after invalid #" << poolsBlock[*validCount].sequence();
+            poolsBlock.resize(*validCount + 1);
+        }
+
+        poolSynchronizer_->getBlockReply(std::move(poolsBlock), sender);
     }
 }
 
-void Node::sendBlockReply(const cs::PoolsBlock& poolsBlock, const cs::PublicKey& target) {
-    if (poolsBlock.empty()) {
+// reply is serialized the same way as cs::PoolsBlock, but from stored block binaries without decoding them
+void Node::sendBlockReply(const cs::PoolsRequestedSequences& sequences, const cs::PublicKey& target) {
+    const auto round = cs::Conveyer::instance().currentRoundNumber();
+
+    if (auto region = blockReplyCache_.find(sequences); region) {
+        csdebug() << "Node> Sending cached reply of " << sequences.size() << " blocks from " << sequences.front() << " to " << sequences.back()
+                  << ", cache hit ratio " << blockReplyCache_.hitRatio() << ", saved "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(blockReplyCache_.savedTime()).count() << " ms";
+        sendDirect(target, MsgTypes::RequestedBlock, round, *region);
         return;
     }
 
-    for (const auto& pool : poolsBlock) {
-        csdetails() << "NODE> Send block reply. Sequence: " << pool.sequence();
+    const auto start = std::chrono::steady_clock::now();
+
+    // blocks may be removed while the reply is built, such a reply is not cached
+    const auto generation = blockReplyCache_.generation();
+
+    std::vector<cs::Bytes> binaries;
+    binaries.reserve(sequences.size());
+
+    cs::Sequence lastSequence = 0;
+    bool complete = true;
+
+    for (auto sequence : sequences) {
+        cs::Bytes binary;
+
+        if (blockChain_.loadBlockBinary(sequence, binary)) {
+            binaries.push_back(std::move(binary));
+            lastSequence = std::max(lastSequence, sequence);
+        }
+        else {
+            csmeta(cslog) << "unable to load block " << sequence << " from blockchain";
+            complete = false;
+        }
+    }
+
+    if (binaries.empty()) {
+        return;
     }
-    
-    csdebug() << "Node> Sending " << poolsBlock.size() << " blocks with signatures from " << poolsBlock.front().sequence() << " to " << poolsBlock.back().sequence();
 
-    for (const auto& it : poolsBlock) {
-        csdetails() << "#" << it.sequence() << " signs = " << it.signatures().size();
+    csdebug() << "Node> Sending " << binaries.size() << " blocks with signatures from " << sequences.front() << " to " << sequences.back();
+
+    cs::Bytes bytes;
+    cs::ODataStream stream(bytes);
+    stream << binaries.size();
+
+    for (const auto& binary : binaries) {
+        stream << cs::BytesView(binary.data(), binary.size());
     }
 
-    auto region = compressor_.compress(poolsBlock);
-    sendDirect(target, MsgTypes::RequestedBlock, cs::Conveyer::instance().currentRoundNumber(), region);
+    auto region = compressor_.compressBinary(bytes);
+    sendDirect(target, MsgTypes::RequestedBlock, round, region);
+
+    // the last block may be replaced while it is uncertain, so it is not cached
+    if (complete && lastSequence < blockChain_.getLastSeq()) {
+        blockReplyCache_.insert(sequences, std::move(region), std::chrono::steady_clock::now() - start, generation);
+    }
 }
 
 void Node::becomeWriter() {
@@ -1409,16 +1498,16 @@ void Node::becomeWriter() {
 void Node::processPacketsRequest(cs::PacketsHashes&& hashes, const cs::RoundNumber round, const cs::PublicKey& sender) {
     csdebug() << "NODE> Processing packets sync request";
 
-    cs::PacketsVector packets;
+    cs::SharedPacketsVector packets;
 
-    const auto& conveyer = cs::Conveyer::instance();
-    std::unique_lock<cs::SharedMutex> lock = conveyer.lock();
-
-    for (const auto& hash : hashes) {
-        std::optional<cs::TransactionsPacket> packet = conveyer.findPacket(hash, round);
+    {
+        const auto& conveyer = cs::Conveyer::instance();
+        std::unique_lock<cs::SharedMutex> lock = conveyer.lock();
 
-        if (packet) {
-            packets.push_back(std::move(packet).value());
+        for (const auto& hash : hashes) {
+            if (cs::TransactionsPacketPtr packet = conveyer.findPacket(hash, round); packet) {
+                packets.push_back(std::move(packet));
+            }
         }
     }
 
@@ -1461,7 +1550,7 @@ void Node::processPacketsReply(cs::PacketsVector&& packets, const cs::RoundNumbe
 }
 
 void Node::processTransactionsPacket(cs::TransactionsPacket&& packet) {
-    cs::Conveyer::instance().addTransactionsPacket(packet);
+    cs::Conveyer::instance().addTransactionsPacket(std::move(packet));
 }
 
 void Node::reviewConveyerHashes() {
@@ -1735,9 +1824,7 @@ void Node::sendBroadcastIfNoConnection(const cs::PublicKeys& keys, const MsgType
     csdetails() << "NODE> Sending broadcast IF NO CONNECTION, round: " << round
                 << ", msgType: " << Packet::messageTypeToString(msgType);
 
-    for (auto& key : keys) {
-        transport_->sendBroadcastIfNoConnection(formPacket(BaseFlags::Compressed, msgType, round, args...), key);
-    }
+    transport_->sendBroadcastIfNoConnection(formPacket(BaseFlags::Compressed, msgType, round, args...), keys);
 }
 
 template <class... Args>
@@ -2531,31 +2618,21 @@ bool Node::receivingSignatures(cs::RoundPackage& rPackage, cs::PublicKeys& curre
         return false;
     }
 
-    cs::Bytes roundBytes = rPackage.bytesToSign();
-    cs::Hash tempHash = cscrypto::calculateHash(roundBytes.data(), roundBytes.size());
+    const auto start = std::chrono::steady_clock::now();
 
-    if (!cs::NodeUtils::checkGroupSignature(currentConfidants, rPackage.poolMetaInfo().realTrustedMask, rPackage.roundSignatures(), tempHash)) {
-        csdebug() << "NODE> The roundtable signatures are NOT OK";
-        return false;
-    }
-    else {
-        csdebug() << "NODE> The roundtable signatures are ok";
-    }
+    // round signatures sign package bytes, trusted confirmations sign round table, all of them are checked as one batch
+    const std::vector<cs::NodeUtils::GroupSignature> groups = {
+        {&rPackage.roundSignatures(), rPackage.hashToSign()},
+        {&rPackage.trustedSignatures(), rPackage.roundTableHash()}
+    };
 
-    //refactored -->
-    cs::Bytes bytes = rPackage.roundTable().toBinary();
-    cs::Hash trustedHash = cscrypto::calculateHash(bytes.data(), bytes.size());
-    //refactored <--
+    const bool result = cs::NodeUtils::checkGroupSignatures(currentConfidants, rPackage.poolMetaInfo().realTrustedMask, groups);
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
 
-    if (cs::NodeUtils::checkGroupSignature(currentConfidants, rPackage.poolMetaInfo().realTrustedMask, rPackage.trustedSignatures(), trustedHash)) {
-        csdebug() << "NODE> The trusted confirmation for the next round are ok";
-    }
-    else {
-        csdebug() << "NODE> The trusted confirmation for the next round are NOT OK";
-        return false;
-    }
+    csdebug() << "NODE> The roundtable signatures and trusted confirmation for the next round are " << (result ? "ok" : "NOT OK")
+              << ", checked in " << duration.count() << " us";
 
-    return true;
+    return result;
 }
 
 bool Node::rpSpeedOk(cs::RoundPackage& rPackage) {
@@ -3320,6 +3397,11 @@ void Node::onRoundStart(const cs::RoundTable& roundTable, bool updateRound) {
         cslog() << " Trusted count: " << roundTable.confidants.size() << ", transaction packets: " << roundTable.hashes.size();
     }
 
+    const auto signaturesStat = cs::SignaturesCache::instance().takeStatistics();
+    csdebug() << " Signatures cache: hits " << signaturesStat.hits << ", misses " << signaturesStat.misses
+              << ", hit rate " << static_cast<int>(signaturesStat.hitRate() * 100) << "%, saved ~"
+              << std::chrono::duration_cast<std::chrono::milliseconds>(signaturesStat.savedTime()).count() << " ms";
+
     csdebug() << line2.str();
     stat_.onRoundStart(cs::Conveyer::instance().currentRoundNumber(), false /*skip_logs*/);
     csdebug() << line2.str();
@@ -3562,7 +3644,14 @@ void Node::validateBlock(const csdb::Pool& block, bool* shouldStop) {
         *shouldStop = true;
         return;
     }
-    if (!blockValidator_->validateBlock(block,
+    if (startupValidator_) {
+        // stateless checks of deep validation are run by block ranges, stateful ones have already passed
+        if (*shouldStop || !startupValidator_->onReadBlock(block)) {
+            *shouldStop = true;
+            return;
+        }
+    }
+    else if (!blockValidator_->validateBlock(block,
         cs::BlockValidator::ValidationLevel::hashIntergrity
             /*| cs::BlockValidator::ValidationLevel::smartStates*/
             /*| cs::BlockValidator::ValidationLevel::accountBalance*/,
@@ -3573,6 +3662,12 @@ void Node::validateBlock(const csdb::Pool& block, bool* shouldStop) {
     processSpecialInfo(block);
 }
 
+void Node::deepValidateReadBlock(const csdb::Pool& block, bool* shouldStop) {
+    if (!startupValidator_->isCheckpointed(block.sequence())) {
+        deepBlockValidation(block, shouldStop);
+    }
+}
+
 void Node::deepBlockValidation(csdb::Pool block, bool* check_failed) {//check_failed should be FALSE of the block is ok 
     *check_failed = false;
     const auto seq = block.sequence();
@@ -3828,7 +3923,7 @@ bool Node::bootstrap(const cs::Bytes& bytes, cs::RoundNumber round) {
 }
 
 void Node::getKnownPeers(std::vector<api_diag::ServerNode>& nodes) {
-    // assume call from processorRoutine() as mentioned in header comment
+    // assume call from a transport lane worker as mentioned in header comment
     std::vector<cs::PeerData> peers;
     transport_->getKnownPeers(peers);
     for (const auto& peer : peers) {
@@ -3875,7 +3970,7 @@ void Node::getKnownPeers(std::vector<api_diag::ServerNode>& nodes) {
 void Node::getNodeInfo(const api_diag::NodeInfoRequest& request, api_diag::NodeInfo& info) {
     cs::Sequence sequence = blockChain_.getLastSeq();
 
-    // assume call from processorRoutine() as mentioned in header comment
+    // assume call from a transport lane worker as mentioned in header comment
     info.id = EncodeBase58(nodeIdKey_.data(), nodeIdKey_.data() + nodeIdKey_.size());
     info.version = std::to_string(NODE_VERSION);
     info.platform = (api_diag::Platform) csconnector::connector::platform();
@@ -1,6 +1,7 @@
 #include <csnode/nodeutils.hpp>
 
 #include <csdb/pool.hpp>
+#include <csnode/signatureverifier.hpp>
 
 #include <lib/system/logger.hpp>
 #include <lib/system/utils.hpp>
@@ -13,6 +14,11 @@ namespace
 namespace cs {
 /*static*/
 bool NodeUtils::checkGroupSignature(const cs::ConfidantsKeys& confidants, const cs::Bytes& mask, const cs::Signatures& signatures, const cs::Hash& hash) {
+    return checkGroupSignatures(confidants, mask, {GroupSignature{&signatures, hash}});
+}
+
+/*static*/
+bool NodeUtils::checkGroupSignatures(const cs::ConfidantsKeys& confidants, const cs::Bytes& mask, const std::vector<GroupSignature>& groups) {
     if (confidants.size() == 0) {
         csdebug() << log_prefix << "the number of confidants is 0";
         return false;
@@ -30,44 +36,73 @@ bool NodeUtils::checkGroupSignature(const cs::ConfidantsKeys& confidants, const
         ++signatureCount;
     }
 
-    if (signatures.size() != signatureCount) {
-        cserror() << log_prefix << "the number of signatures doesn't correspond the mask value";
+    for (const auto& group : groups) {
+        const auto& signatures = *group.signatures;
 
-        std::string realTrustedString;
+        if (signatures.size() != signatureCount) {
+            cserror() << log_prefix << "the number of signatures doesn't correspond the mask value";
 
-        for (auto& i : mask) {
-            realTrustedString = realTrustedString + "[" + std::to_string(int(i)) + "] ";
-        }
+            std::string realTrustedString;
+
+            for (auto& i : mask) {
+                realTrustedString = realTrustedString + "[" + std::to_string(int(i)) + "] ";
+            }
+
+            csdebug() << log_prefix << "mask: " << realTrustedString << ", signatures: ";
+            for (auto& it : signatures) {
+                csdebug() << '\t' << cs::Utils::byteStreamToHex(it);
+            }
 
-        csdebug() << log_prefix << "mask: " << realTrustedString << ", signatures: ";
-        for (auto& it : signatures) {
-            csdebug() << '\t' << cs::Utils::byteStreamToHex(it);
+            return false;
         }
+    }
 
-        return false;
+    // block signatures are memoized, the ones checked by block validator ahead are not verified twice
+    cs::SignatureVerifier::Batch batch;
+    batch.reserve(signatureCount * groups.size());
+
+    for (const auto& group : groups) {
+        csdebug() << log_prefix << "hash: " << cs::Utils::byteStreamToHex(group.hash);
+
+        size_t index = 0;
+        size_t cnt = 0;
+        for (auto it : mask) {
+            if (it != cs::ConfidantConsts::InvalidConfidantIndex) {
+                auto entry = cs::SignatureVerifier::makeEntry(group.hash, confidants[cnt], (*group.signatures)[index]);
+                entry.memoize = true;
+                batch.push_back(std::move(entry));
+                ++index;
+            }
+            ++cnt;
+        }
     }
 
-    signatureCount = 0;
-    size_t cnt = 0;
+    const auto results = cs::SignatureVerifier::verify(batch);
+
     bool validSig = true;
     size_t cntValid = 0;
     size_t cntInvalid = 0;
-    csdebug() << log_prefix << "hash: " << cs::Utils::byteStreamToHex(hash);
-    for (auto it : mask) {
-        if (it != cs::ConfidantConsts::InvalidConfidantIndex) {
-            if (cscrypto::verifySignature(signatures[signatureCount], confidants[cnt], hash.data(), hash.size())) {
-                csdetails() << log_prefix << "signature of [" << cnt << "] is valid";
-                ++signatureCount;
-                ++cntValid;
-            }
-            else {
-                csdebug() << log_prefix << "signature of [" << cnt << "] is NOT VALID: " << cs::Utils::byteStreamToHex(signatures[signatureCount]);
-                validSig = false;
-                ++signatureCount;
-                ++cntInvalid;
+    size_t result = 0;
+
+    for (const auto& group : groups) {
+        size_t index = 0;
+        size_t cnt = 0;
+        for (auto it : mask) {
+            if (it != cs::ConfidantConsts::InvalidConfidantIndex) {
+                if (results[result]) {
+                    csdetails() << log_prefix << "signature of [" << cnt << "] is valid";
+                    ++cntValid;
+                }
+                else {
+                    csdebug() << log_prefix << "signature of [" << cnt << "] is NOT VALID: " << cs::Utils::byteStreamToHex((*group.signatures)[index]);
+                    validSig = false;
+                    ++cntInvalid;
+                }
+                ++index;
+                ++result;
             }
+            ++cnt;
         }
-        ++cnt;
     }
     if (!validSig) {
         csdebug() << log_prefix << "signatures (" << cntInvalid << ") are not valid";
@@ -5,6 +5,7 @@ cs::PacketQueue::PacketQueue(size_t queueSize, size_t transactionsSize, size_t p
 : maxQueueSize_(queueSize)
 , maxTransactionsSize_(transactionsSize)
 , maxPacketsPerRound_(packetsPerRound) {
+    transactionsCount_ = 0;
     cachedRound_ = 0;
     cachedPackets_ = 0;
 }
@@ -18,13 +19,45 @@ bool cs::PacketQueue::push(const csdb::Transaction& transaction) {
         queue_.push_back(cs::TransactionsPacket{});
     }
 
-    return queue_.back().addTransaction(transaction);
+    if (!queue_.back().addTransaction(transaction)) {
+        return false;
+    }
+
+    ++transactionsCount_;
+    ++signatures_[transaction.signature()];
+    return true;
 }
 
 void cs::PacketQueue::push(const cs::TransactionsPacket& packet) {
     // ignore size of queue for packs
     queue_.push_back(packet);
     queue_.push_back(cs::TransactionsPacket{});
+
+    add(packet);
+}
+
+std::vector<cs::PacketQueue::PushResult> cs::PacketQueue::push(const std::vector<csdb::Transaction>& transactions) {
+    std::vector<PushResult> results(transactions.size(), PushResult::Full);
+
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        // pushed ones of the batch are queued already
+        if (contains(transactions[i].signature())) {
+            results[i] = PushResult::Duplicate;
+            continue;
+        }
+
+        if (!push(transactions[i])) {
+            break;
+        }
+
+        results[i] = PushResult::Pushed;
+    }
+
+    return results;
+}
+
+bool cs::PacketQueue::contains(const cs::Signature& signature) const {
+    return signatures_.find(signature) != signatures_.end();
 }
 
 cs::PacketsVector cs::PacketQueue::pop() {
@@ -40,6 +73,8 @@ cs::PacketsVector cs::PacketQueue::pop() {
     }
 
     while (!queue_.empty() && cachedPackets_ < maxPacketsPerRound_) {
+        remove(queue_.front());
+
         block.push_back(std::move(queue_.front()));
         queue_.pop_front();
 
@@ -62,6 +97,10 @@ size_t cs::PacketQueue::size() const {
     return queue_.size();
 }
 
+size_t cs::PacketQueue::transactionsCount() const {
+    return transactionsCount_;
+}
+
 bool cs::PacketQueue::isEmpty() const {
     return queue_.empty();
 }
@@ -69,3 +108,23 @@ bool cs::PacketQueue::isEmpty() const {
 std::deque<cs::TransactionsPacket>::const_reference cs::PacketQueue::back() const {
     return queue_.back();
 }
+
+void cs::PacketQueue::add(const cs::TransactionsPacket& packet) {
+    transactionsCount_ += packet.transactionsCount();
+
+    for (const auto& transaction : packet.transactions()) {
+        ++signatures_[transaction.signature()];
+    }
+}
+
+void cs::PacketQueue::remove(const cs::TransactionsPacket& packet) {
+    transactionsCount_ -= packet.transactionsCount();
+
+    for (const auto& transaction : packet.transactions()) {
+        auto iter = signatures_.find(transaction.signature());
+
+        if (iter != signatures_.end() && --iter->second == 0) {
+            signatures_.erase(iter);
+        }
+    }
+}
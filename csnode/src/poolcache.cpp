@@ -14,7 +14,7 @@ cs::PoolCache::~PoolCache() {
 }
 
 void cs::PoolCache::insert(const csdb::Pool& pool, PoolStoreType type) {
-    insert(pool.sequence(), pool.to_binary(), type);
+    insert(pool.sequence(), pool.binary(), type);
 }
 
 void cs::PoolCache::insert(cs::Sequence sequence, const cs::Bytes& bytes, cs::PoolStoreType type) {
@@ -34,6 +34,9 @@ bool RoundPackage::fromBinary(const cs::Bytes& bytes, cs::RoundNumber rNum, cs::
     cs::IDataStream roundStream(bytes.data(), bytes.size());
     cs::ConfidantsKeys confidants;
 
+    resetToSign();
+    roundTableHashCached_ = false;
+
     roundTable_.round = rNum;
     // subRound_ = subRound;
     roundStream >> roundTable_.confidants;
@@ -152,30 +155,61 @@ std::string RoundPackage::toString() {
     return packageString;
 }
 
-cs::Bytes RoundPackage::bytesToSign() {
-    refillToSign();
-    cs::Bytes bytes(binaryRepresentation_.data(), binaryRepresentation_.data() + messageSize_);
-    return bytes;
+const cs::Bytes& RoundPackage::bytesToSign() {
+    if (!toSignCached_) {
+        // binary starts with bytes to sign while it is not reset
+        if (binaryRepresentation_.empty()) {
+            refillToSign();
+        }
+
+        bytesToSign_.assign(binaryRepresentation_.data(), binaryRepresentation_.data() + messageSize_);
+        hashToSign_ = cscrypto::calculateHash(bytesToSign_.data(), bytesToSign_.size());
+        toSignCached_ = true;
+    }
+
+    return bytesToSign_;
+}
+
+const cs::Hash& RoundPackage::hashToSign() {
+    bytesToSign();
+    return hashToSign_;
+}
+
+const cs::Hash& RoundPackage::roundTableHash() {
+    if (!roundTableHashCached_) {
+        const cs::Bytes bytes = roundTable_.toBinary();
+        roundTableHash_ = cscrypto::calculateHash(bytes.data(), bytes.size());
+        roundTableHashCached_ = true;
+    }
+
+    return roundTableHash_;
 }
 
 void RoundPackage::updatePoolMeta(const cs::PoolMetaInfo& meta) {
     poolMetaInfo_ = meta;
+    resetToSign();
 }
 
 void RoundPackage::updateRoundTable(const cs::RoundTable& roundTable) {
     roundTable_ = roundTable;
+    resetToSign();
+    roundTableHashCached_ = false;
 }
 
+// signatures follow bytes to sign in binary, so they are appended again by toBinary
 void RoundPackage::updateRoundSignatures(const cs::Signatures& signatures) {
     roundSignatures_ = signatures;
+    binaryRepresentation_.resize(messageSize_);
 }
 
 void RoundPackage::updatePoolSignatures(const cs::Signatures& signatures) {
     poolSignatures_ = signatures;
+    binaryRepresentation_.resize(messageSize_);
 }
 
 void RoundPackage::updateTrustedSignatures(const Signatures& signatures) {
     trustedSignatures_ = signatures;
+    binaryRepresentation_.resize(messageSize_);
 }
 
 const PoolMetaInfo& RoundPackage::poolMetaInfo() const {
@@ -224,6 +258,12 @@ void RoundPackage::refillToSign() {
     messageSize_ = binaryRepresentation_.size();
 }
 
+void RoundPackage::resetToSign() {
+    binaryRepresentation_.clear();
+    messageSize_ = 0;
+    toSignCached_ = false;
+}
+
 void RoundPackage::setSenderNode(const cs::PublicKey& sender) {
     sender_ = std::make_shared<cs::PublicKey>(sender);
 }
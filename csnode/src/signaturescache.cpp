@@ -0,0 +1,120 @@
+#include <csnode/signaturescache.hpp>
+
+#include <algorithm>
+
+#include <cscrypto/cscrypto.hpp>
+
+namespace cs {
+double SignaturesCache::Statistics::hitRate() const {
+    const size_t total = hits + misses;
+    return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+}
+
+std::chrono::nanoseconds SignaturesCache::Statistics::savedTime() const {
+    if (misses == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+
+    return verifyTime / static_cast<int64_t>(misses) * static_cast<int64_t>(hits);
+}
+
+SignaturesCache::SignaturesCache(size_t capacity)
+: shardCapacity_(std::max<size_t>(capacity / kShardsCount, 1)) {
+}
+
+SignaturesCache& SignaturesCache::instance() {
+    static SignaturesCache cache;
+    return cache;
+}
+
+cs::Hash SignaturesCache::makeKey(const cs::Hash& messageHash, const cs::PublicKey& key, const cs::Signature& signature) {
+    std::array<cs::Byte, sizeof(cs::Hash) + sizeof(cs::PublicKey) + sizeof(cs::Signature)> bytes;
+
+    auto end = std::copy(messageHash.begin(), messageHash.end(), bytes.begin());
+    end = std::copy(key.begin(), key.end(), end);
+    std::copy(signature.begin(), signature.end(), end);
+
+    return cscrypto::calculateHash(bytes.data(), bytes.size());
+}
+
+bool SignaturesCache::contains(const cs::Hash& key) {
+    auto& keyShard = shard(key);
+    bool found = false;
+
+    {
+        cs::Lock lock(keyShard.mutex);
+        found = keyShard.keys.contains(key);
+    }
+
+    ++(found ? hits_ : misses_);
+    return found;
+}
+
+void SignaturesCache::insert(const cs::Hash& key) {
+    auto& keyShard = shard(key);
+    cs::Lock lock(keyShard.mutex);
+
+    if (!keyShard.keys.emplace(key, cs::Byte{1}).second) {
+        return;
+    }
+
+    if (keyShard.order.size() < shardCapacity_) {
+        keyShard.order.push_back(key);
+        return;
+    }
+
+    keyShard.keys.erase(keyShard.order[keyShard.next]);
+    keyShard.order[keyShard.next] = key;
+    keyShard.next = (keyShard.next + 1) % shardCapacity_;
+}
+
+void SignaturesCache::addVerifyTime(std::chrono::nanoseconds time) {
+    verifyTime_ += time.count();
+}
+
+size_t SignaturesCache::size() const {
+    size_t result = 0;
+
+    for (const auto& keyShard : shards_) {
+        cs::Lock lock(keyShard.mutex);
+        result += keyShard.keys.size();
+    }
+
+    return result;
+}
+
+size_t SignaturesCache::capacity() const {
+    return shardCapacity_ * kShardsCount;
+}
+
+void SignaturesCache::clear() {
+    for (auto& keyShard : shards_) {
+        cs::Lock lock(keyShard.mutex);
+        keyShard.keys.clear();
+        keyShard.order.clear();
+        keyShard.next = 0;
+    }
+}
+
+SignaturesCache::Statistics SignaturesCache::statistics() const {
+    Statistics result;
+    result.hits = hits_.load();
+    result.misses = misses_.load();
+    result.verifyTime = std::chrono::nanoseconds(verifyTime_.load());
+
+    return result;
+}
+
+SignaturesCache::Statistics SignaturesCache::takeStatistics() {
+    Statistics result;
+    result.hits = hits_.exchange(0);
+    result.misses = misses_.exchange(0);
+    result.verifyTime = std::chrono::nanoseconds(verifyTime_.exchange(0));
+
+    return result;
+}
+
+SignaturesCache::Shard& SignaturesCache::shard(const cs::Hash& key) {
+    return shards_[key.back() % kShardsCount];
+}
+}  // namespace cs
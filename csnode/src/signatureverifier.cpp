@@ -0,0 +1,69 @@
+#include <csnode/signatureverifier.hpp>
+#include <csnode/signaturescache.hpp>
+
+#include <atomic>
+
+#include <csdb/transaction.hpp>
+#include <cscrypto/cscrypto.hpp>
+
+#include <lib/system/concurrent.hpp>
+
+namespace cs {
+SignatureVerifier::Entry SignatureVerifier::makeEntry(const csdb::Transaction& transaction, const cs::PublicKey& key) {
+    return Entry{transaction.signing_bytes(), key, transaction.signature(), true, transaction.signing_hash()};
+}
+
+SignatureVerifier::Entry SignatureVerifier::makeEntry(const cs::Hash& hash, const cs::PublicKey& key, const cs::Signature& signature) {
+    return Entry{std::make_shared<const cs::Bytes>(hash.begin(), hash.end()), key, signature};
+}
+
+// cscrypto provides single signature check only, so batch is spread between cores
+// and each entry gets its own result, failed entries are known without second pass
+SignatureVerifier::Results SignatureVerifier::verify(const Batch& batch) {
+    Results results(batch.size(), 0);
+
+    cs::Concurrent::parallelFor(batch.size(), kMinChunkSize, [&](size_t index) {
+        results[index] = static_cast<cs::Byte>(verify(batch[index]));
+    });
+
+    return results;
+}
+
+bool SignatureVerifier::verifyAll(const Batch& batch) {
+    std::atomic<bool> failed = false;
+
+    cs::Concurrent::parallelFor(batch.size(), kMinChunkSize, [&](size_t index) {
+        if (!failed.load(std::memory_order_relaxed) && !verify(batch[index])) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    return !failed.load();
+}
+
+bool SignatureVerifier::verify(const Entry& entry) {
+    const cs::Bytes& message = *entry.message;
+
+    if (!entry.memoize) {
+        return cscrypto::verifySignature(entry.signature, entry.publicKey, message.data(), message.size());
+    }
+
+    auto& cache = SignaturesCache::instance();
+    const auto messageHash = entry.messageHash ? *entry.messageHash : cscrypto::calculateHash(message.data(), message.size());
+    const auto key = SignaturesCache::makeKey(messageHash, entry.publicKey, entry.signature);
+
+    if (cache.contains(key)) {
+        return true;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool result = cscrypto::verifySignature(entry.signature, entry.publicKey, message.data(), message.size());
+    cache.addVerifyTime(std::chrono::steady_clock::now() - start);
+
+    if (result) {
+        cache.insert(key);
+    }
+
+    return result;
+}
+}  // namespace cs
@@ -0,0 +1,158 @@
+#include <csnode/startupvalidator.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include <lib/system/logger.hpp>
+
+namespace {
+const char* kLogPrefix = "StartupValidator: ";
+constexpr const char* kCheckpointPath = "/last_validated";
+
+std::string formatDuration(int64_t seconds) {
+    std::ostringstream os;
+    os << seconds / 3600 << ':' << std::setfill('0') << std::setw(2) << seconds / 60 % 60 << ':' << std::setw(2) << seconds % 60;
+    return os.str();
+}
+}  // namespace
+
+namespace cs {
+StartupValidator::StartupValidator(BlockValidator& validator, const std::string& dbPath)
+: StartupValidator(dbPath) {
+    validator_ = &validator;
+}
+
+StartupValidator::StartupValidator(const std::string& dbPath)
+: checkpoint_(readCheckpoint(dbPath + kCheckpointPath))
+, checkpointFile_(dbPath + kCheckpointPath, sizeof(Checkpoint)) {
+    // mapped sink is created anew, so restore the read value
+    storeCheckpoint(checkpoint_);
+    range_.reserve(kRangeSize);
+}
+
+void StartupValidator::onStartReading(cs::Sequence lastSequence) {
+    lastSequence_ = lastSequence;
+
+    if (checkpoint_.sequence > lastSequence_) {
+        cswarning() << kLogPrefix << "checkpoint #" << WithDelimiters(checkpoint_.sequence) << " is beyond the last block, validate the whole chain";
+        checkpoint_ = Checkpoint{};
+        storeCheckpoint(checkpoint_);
+    }
+    else if (checkpoint_.sequence > 0) {
+        cslog() << kLogPrefix << "blocks 0.." << WithDelimiters(checkpoint_.sequence) << " have been validated before, validate the following ones";
+    }
+
+    firstSequence_ = checkpoint_.sequence + 1;
+    startTime_ = std::chrono::steady_clock::now();
+    reportTime_ = startTime_;
+}
+
+bool StartupValidator::onReadBlock(const csdb::Pool& block) {
+    const auto sequence = block.sequence();
+
+    if (isCheckpointed(sequence)) {
+        if (sequence == checkpoint_.sequence && sequence != 0 && blockHash(block) != checkpoint_.hash) {
+            cswarning() << kLogPrefix << "block #" << WithDelimiters(sequence) << " differs from the validated one, the whole chain is validated on the next start";
+            checkpointMismatch_ = true;
+            storeCheckpoint(Checkpoint{});
+        }
+
+        return validateCheckpointed(block);
+    }
+
+    range_.push_back(block);
+
+    if (range_.size() < kRangeSize && sequence < lastSequence_) {
+        return true;
+    }
+
+    return validateRange();
+}
+
+bool StartupValidator::validateRange() {
+    const size_t validCount = validateBlocks(range_);
+    const bool isValid = validCount == range_.size();
+
+    if (!isValid) {
+        const auto sequence = range_[validCount].sequence();
+        cserror() << kLogPrefix << "block #" << WithDelimiters(sequence) << " is invalid, restart node with --set-bc-top " << sequence - 1;
+    }
+
+    if (validCount > 0 && !checkpointMismatch_) {
+        const auto& block = range_[validCount - 1];
+        checkpoint_ = Checkpoint{block.sequence(), blockHash(block)};
+        storeCheckpoint(checkpoint_);
+    }
+
+    validatedCount_ += validCount;
+    reportProgress(isValid && range_.back().sequence() >= lastSequence_);
+
+    range_.clear();
+    return isValid;
+}
+
+bool StartupValidator::validateCheckpointed(const csdb::Pool& block) {
+    return validator_->validateBlock(block, BlockValidator::hashIntergrity, BlockValidator::onlyFatalErrors);
+}
+
+size_t StartupValidator::validateBlocks(const std::vector<csdb::Pool>& blocks) {
+    return validator_->validateBlocks(blocks, kStatelessFlags);
+}
+
+void StartupValidator::reportProgress(bool finished) {
+    const auto now = std::chrono::steady_clock::now();
+
+    if (!finished && now - reportTime_ < kReportPeriod) {
+        return;
+    }
+
+    reportTime_ = now;
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - startTime_).count();
+
+    if (finished) {
+        cslog() << kLogPrefix << "validated " << WithDelimiters(validatedCount_) << " blocks in " << formatDuration(elapsed);
+        return;
+    }
+
+    const size_t total = lastSequence_ >= firstSequence_ ? static_cast<size_t>(lastSequence_ - firstSequence_ + 1) : validatedCount_;
+    const size_t remaining = total - std::min(total, validatedCount_);
+    const double speed = elapsed > 0 ? static_cast<double>(validatedCount_) / static_cast<double>(elapsed) : 0.0;
+
+    cslog() << kLogPrefix << "validated " << WithDelimiters(validatedCount_) << " of " << WithDelimiters(total)
+            << " blocks (" << (total ? validatedCount_ * 100 / total : 100) << "%), "
+            << static_cast<size_t>(speed) << " blocks/s, ETA "
+            << (speed > 0 ? formatDuration(static_cast<int64_t>(static_cast<double>(remaining) / speed)) : std::string("unknown"));
+}
+
+StartupValidator::Checkpoint StartupValidator::readCheckpoint(const std::string& path) {
+    boost::filesystem::path p(path);
+    if (!boost::filesystem::is_regular_file(p)) {
+        return Checkpoint{};
+    }
+
+    MMappedFileWrap<FileSource> file(path, sizeof(Checkpoint), false);
+    if (!file.isOpen()) {
+        return Checkpoint{};
+    }
+
+    return *file.data<const Checkpoint>();
+}
+
+void StartupValidator::storeCheckpoint(const Checkpoint& checkpoint) {
+    auto ptr = checkpointFile_.data<Checkpoint>();
+    if (ptr) {
+        *ptr = checkpoint;
+    }
+}
+
+cs::Hash StartupValidator::blockHash(const csdb::Pool& block) {
+    cs::Hash result{};
+    const auto hash = block.hash().to_binary();
+    std::copy_n(hash.begin(), std::min(hash.size(), result.size()), result.begin());
+    return result;
+}
+}  // namespace cs
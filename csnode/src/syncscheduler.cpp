@@ -0,0 +1,289 @@
+#include <csnode/syncscheduler.hpp>
+
+#include <algorithm>
+
+namespace {
+// request is late when it takes this many round trip times
+constexpr int64_t kTimeoutRtts = 3;
+
+// request is taken over by neighbour this many times faster
+constexpr size_t kStealSpeedup = 2;
+
+// weight of a new sample in moving averages
+constexpr double kSampleWeight = 0.25;
+}  // namespace
+
+namespace cs {
+SyncScheduler::SyncScheduler()
+: SyncScheduler(Settings{}) {
+}
+
+SyncScheduler::SyncScheduler(const Settings& settings)
+: settings_(settings) {
+}
+
+void SyncScheduler::addNeighbour(const cs::PublicKey& key, cs::Sequence maxSequence) {
+    if (auto neighbour = findNeighbour(key); neighbour) {
+        neighbour->maxSequence = maxSequence;
+        return;
+    }
+
+    Neighbour neighbour;
+    neighbour.key = key;
+    neighbour.maxSequence = maxSequence;
+    neighbour.requestsLimit = std::max<size_t>(settings_.maxRequestsInFlight / 2, 1);
+    neighbour.rtt = settings_.initialRtt;
+
+    neighbours_.push_back(std::move(neighbour));
+}
+
+void SyncScheduler::removeNeighbour(const cs::PublicKey& key) {
+    auto iter = std::find_if(neighbours_.begin(), neighbours_.end(), [&](const Neighbour& neighbour) {
+        return neighbour.key == key;
+    });
+
+    if (iter == neighbours_.end()) {
+        return;
+    }
+
+    for (const auto& request : iter->requests) {
+        release(request);
+    }
+
+    neighbours_.erase(iter);
+}
+
+void SyncScheduler::setNeighbourRtt(const cs::PublicKey& key, Duration rtt) {
+    if (auto neighbour = findNeighbour(key); neighbour && rtt > Duration::zero()) {
+        neighbour->pingRtt = rtt;
+    }
+}
+
+void SyncScheduler::onReply(const cs::PublicKey& key, const PoolsRequestedSequences& received, TimePoint now) {
+    auto neighbour = findNeighbour(key);
+
+    if (!neighbour || neighbour->requests.empty()) {
+        return;
+    }
+
+    // reply answers the request with its first sequence, empty reply answers the oldest one
+    auto iter = neighbour->requests.begin();
+
+    if (!received.empty()) {
+        iter = std::find_if(neighbour->requests.begin(), neighbour->requests.end(), [&](const PendingRequest& request) {
+            return std::find(request.sequences.begin(), request.sequences.end(), received.front()) != request.sequences.end();
+        });
+
+        // late reply of expired request
+        if (iter == neighbour->requests.end()) {
+            return;
+        }
+    }
+
+    // requests are served one by one, so throughput is measured from the previous reply
+    const Duration rtt = now - iter->sentAt;
+    const Duration serviceTime = now - std::max(iter->sentAt, neighbour->lastReply);
+    const double seconds = std::max(std::chrono::duration<double>(serviceTime).count(), 1e-3);
+    const double throughput = static_cast<double>(received.size()) / seconds;
+
+    if (neighbour->throughput == 0) {
+        neighbour->throughput = throughput;
+        neighbour->rtt = rtt;
+    }
+    else {
+        neighbour->throughput += (throughput - neighbour->throughput) * kSampleWeight;
+        neighbour->rtt += std::chrono::duration_cast<Duration>((rtt - neighbour->rtt) * kSampleWeight);
+    }
+
+    neighbour->lastReply = now;
+    neighbour->requestsLimit = std::min(neighbour->requestsLimit + 1, settings_.maxRequestsInFlight);
+
+    release(*iter);
+    neighbour->requests.erase(iter);
+}
+
+void SyncScheduler::onStored(cs::Sequence sequence) {
+    inFlight_.erase(sequence);
+}
+
+std::vector<SyncScheduler::Request> SyncScheduler::schedule(const std::vector<Interval>& required, cs::Sequence limit, TimePoint now) {
+    expire(now);
+
+    std::vector<Neighbour*> order;
+    size_t capacity = 0;
+
+    for (auto& neighbour : neighbours_) {
+        if (neighbour.requests.size() < neighbour.requestsLimit) {
+            order.push_back(&neighbour);
+            capacity += (neighbour.requestsLimit - neighbour.requests.size()) * requestSize(neighbour);
+        }
+    }
+
+    std::vector<Request> result;
+
+    if (order.empty()) {
+        return result;
+    }
+
+    // the lowest sequences are written first, so they go to the fastest neighbours
+    std::stable_sort(order.begin(), order.end(), [this](const Neighbour* lhs, const Neighbour* rhs) {
+        const size_t lhsSize = requestSize(*lhs);
+        const size_t rhsSize = requestSize(*rhs);
+        return lhsSize != rhsSize ? lhsSize > rhsSize : lhs->pingRtt < rhs->pingRtt;
+    });
+
+    PoolsRequestedSequences free;
+
+    for (const auto& [first, second] : required) {
+        const cs::Sequence last = second == 0 ? limit : std::min(second, limit);
+
+        for (cs::Sequence sequence = first; sequence <= last && free.size() < capacity; ++sequence) {
+            if (!inFlight_.count(sequence)) {
+                free.push_back(sequence);
+            }
+        }
+    }
+
+    size_t position = 0;
+    bool assigned = true;
+
+    while (position < free.size() && assigned) {
+        assigned = false;
+
+        for (Neighbour* neighbour : order) {
+            if (position == free.size()) {
+                break;
+            }
+
+            if (neighbour->requests.size() >= neighbour->requestsLimit || free[position] > neighbour->maxSequence) {
+                continue;
+            }
+
+            const size_t size = requestSize(*neighbour);
+
+            PendingRequest request;
+            request.sentAt = now;
+            request.deadline = now + timeout(*neighbour);
+
+            while (position < free.size() && request.sequences.size() < size && free[position] <= neighbour->maxSequence) {
+                request.sequences.push_back(free[position]);
+                inFlight_.insert(free[position]);
+                ++position;
+            }
+
+            result.push_back(Request{neighbour->key, request.sequences});
+            neighbour->requests.push_back(std::move(request));
+
+            assigned = true;
+        }
+    }
+
+    if (position == free.size()) {
+        steal(order, result, now);
+    }
+
+    return result;
+}
+
+void SyncScheduler::reset() {
+    for (auto& neighbour : neighbours_) {
+        neighbour.requests.clear();
+    }
+
+    inFlight_.clear();
+}
+
+SyncScheduler::Neighbour* SyncScheduler::findNeighbour(const cs::PublicKey& key) {
+    auto iter = std::find_if(neighbours_.begin(), neighbours_.end(), [&](const Neighbour& neighbour) {
+        return neighbour.key == key;
+    });
+
+    return iter != neighbours_.end() ? &(*iter) : nullptr;
+}
+
+void SyncScheduler::release(const PendingRequest& request) {
+    for (auto sequence : request.sequences) {
+        inFlight_.erase(sequence);
+    }
+}
+
+// the window is exhausted, so the lowest requests of much slower neighbours hold writing back
+void SyncScheduler::steal(const std::vector<Neighbour*>& order, std::vector<Request>& result, TimePoint now) {
+    for (Neighbour* thief : order) {
+        const size_t thiefSize = requestSize(*thief);
+
+        while (thief->requests.size() < thief->requestsLimit) {
+            Neighbour* victim = nullptr;
+            std::deque<PendingRequest>::iterator lowest;
+
+            for (auto& neighbour : neighbours_) {
+                if (neighbour.requests.empty() || requestSize(neighbour) * kStealSpeedup > thiefSize) {
+                    continue;
+                }
+
+                for (auto iter = neighbour.requests.begin(); iter != neighbour.requests.end(); ++iter) {
+                    if (iter->sequences.back() > thief->maxSequence) {
+                        continue;
+                    }
+
+                    if (!victim || iter->sequences.front() < lowest->sequences.front()) {
+                        victim = &neighbour;
+                        lowest = iter;
+                    }
+                }
+            }
+
+            if (!victim) {
+                break;
+            }
+
+            PendingRequest request = std::move(*lowest);
+            victim->requests.erase(lowest);
+
+            request.sentAt = now;
+            request.deadline = now + timeout(*thief);
+
+            result.push_back(Request{thief->key, request.sequences});
+            thief->requests.push_back(std::move(request));
+        }
+    }
+}
+
+void SyncScheduler::expire(TimePoint now) {
+    for (auto& neighbour : neighbours_) {
+        bool expired = false;
+
+        for (auto iter = neighbour.requests.begin(); iter != neighbour.requests.end();) {
+            if (iter->deadline > now) {
+                ++iter;
+                continue;
+            }
+
+            release(*iter);
+            iter = neighbour.requests.erase(iter);
+
+            ++timeouts_;
+            expired = true;
+        }
+
+        // slow neighbour gets one smaller request at a time until it replies
+        if (expired) {
+            neighbour.throughput /= 2;
+            neighbour.requestsLimit = 1;
+        }
+    }
+}
+
+size_t SyncScheduler::requestSize(const Neighbour& neighbour) const {
+    if (neighbour.throughput == 0) {
+        return std::clamp(settings_.initialRequestSize, settings_.minRequestSize, settings_.maxRequestSize);
+    }
+
+    const double size = neighbour.throughput * std::chrono::duration<double>(settings_.targetRequestTime).count();
+    return std::clamp(static_cast<size_t>(size), settings_.minRequestSize, settings_.maxRequestSize);
+}
+
+SyncScheduler::Duration SyncScheduler::timeout(const Neighbour& neighbour) const {
+    return std::clamp(neighbour.rtt * kTimeoutRtts, settings_.minTimeout, settings_.maxTimeout);
+}
+}  // namespace cs
@@ -0,0 +1,252 @@
+#include <csnode/transactionsgraph.hpp>
+
+#include <algorithm>
+
+#include <lib/system/concurrent.hpp>
+#include <lib/system/logger.hpp>
+
+namespace {
+const char* kLogPrefix = "Graph: ";
+const csdb::Amount kZeroBalance = 0.0_c;
+}  // namespace
+
+namespace cs {
+TransactionsGraph::TransactionsGraph(const Transactions& trxs, TrxList& trxList, CharacteristicMask& maskIncluded)
+: trxs_(trxs)
+, trxList_(trxList)
+, maskIncluded_(maskIncluded) {
+}
+
+size_t TransactionsGraph::resolve(Stack& negativeNodes, const TargetResolver& resolver) {
+    build(negativeNodes, resolver);
+
+    // negative nodes of the same component keep their order, so LIFO processing of each component
+    // removes the same transactions as LIFO processing of all of them
+    std::vector<Component> components;
+    std::vector<size_t> componentIds(parents_.size(), components.max_size());
+
+    for (Node* node : negativeNodes) {
+        const size_t root = find(nodeIds_[node]);
+
+        if (componentIds[root] == components.max_size()) {
+            componentIds[root] = components.size();
+            components.emplace_back();
+        }
+
+        components[componentIds[root]].negativeNodes.push_back(node);
+    }
+
+    negativeNodes.clear();
+
+    cs::Concurrent::parallelFor(components.size(), kMinComponentsChunk, [&](size_t index) {
+        process(components[index]);
+    });
+
+    size_t removed = 0;
+
+    for (const auto& component : components) {
+        removed += component.removed;
+    }
+
+    csdebug() << kLogPrefix << "nodes " << parents_.size() << ", components " << components.size() << ", removed " << removed;
+    return removed;
+}
+
+void TransactionsGraph::build(const Stack& negativeNodes, const TargetResolver& resolver) {
+    edges_.resize(trxs_.size());
+
+    Stack pending;
+
+    for (Node* node : negativeNodes) {
+        nodeId(node, pending);
+    }
+
+    // only wallets reachable from negative ones may be changed by removal
+    while (!pending.empty()) {
+        Node* node = pending.back();
+        pending.pop_back();
+
+        const size_t id = nodeIds_[node];
+
+        for (TransactionIndex trxInd = node->lastTrxInd_; trxInd != WalletsState::noInd_; trxInd = trxList_[trxInd]) {
+            const csdb::Transaction& trx = trxs_[trxInd];
+            const Target target = resolver(trx.target());
+
+            Edge& edge = edges_[trxInd];
+            edge.target = target.node;
+            edge.amount = trx.amount();
+            edge.fee = target.isSmart ? csdb::Amount(trx.max_fee().to_double()) : csdb::Amount(trx.counted_fee().to_double());
+            edge.cost = edge.amount.to_double();
+            edge.cost += edge.fee;
+
+            unite(id, nodeId(target.node, pending));
+        }
+    }
+}
+
+size_t TransactionsGraph::nodeId(Node* node, Stack& pending) {
+    const auto [iter, inserted] = nodeIds_.try_emplace(node, parents_.size());
+
+    if (inserted) {
+        parents_.push_back(iter->second);
+        pending.push_back(node);
+    }
+
+    return iter->second;
+}
+
+size_t TransactionsGraph::find(size_t id) {
+    while (parents_[id] != id) {
+        parents_[id] = parents_[parents_[id]];
+        id = parents_[id];
+    }
+
+    return id;
+}
+
+void TransactionsGraph::unite(size_t lhs, size_t rhs) {
+    lhs = find(lhs);
+    rhs = find(rhs);
+
+    if (lhs != rhs) {
+        parents_[std::max(lhs, rhs)] = std::min(lhs, rhs);
+    }
+}
+
+void TransactionsGraph::process(Component& component) {
+    while (!component.negativeNodes.empty()) {
+        Node& node = *component.negativeNodes.back();
+        component.negativeNodes.pop_back();
+
+        if (node.balance_ >= kZeroBalance) {
+            continue;
+        }
+
+        removeTransactions(node, component);
+    }
+}
+
+void TransactionsGraph::removeTransactions(Node& node, Component& component) {
+    if (removeTransactions_PositiveOne(node, component)) {
+        return;
+    }
+    if (removeTransactions_PositiveAll(node, component)) {
+        return;
+    }
+    if (removeTransactions_NegativeOne(node, component)) {
+        return;
+    }
+    if (removeTransactions_NegativeAll(node, component)) {
+        return;
+    }
+
+    csdebug() << "removeTransactions: Failed to make balance non-negative ";
+}
+
+bool TransactionsGraph::removeTransactions_PositiveOne(Node& node, Component& component) {
+    if (node.balance_ >= kZeroBalance)
+        return true;
+
+    const csdb::Amount absBalance = -node.balance_;
+    TransactionIndex* prevNext = &node.lastTrxInd_;
+
+    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
+        const Edge& edge = edges_[trxInd];
+
+        if (edge.cost < absBalance || edge.amount > edge.target->balance_) {
+            prevNext = &trxList_[trxInd];
+            continue;
+        }
+
+        remove(node, prevNext, trxInd, component);
+        return true;
+    }
+
+    return false;
+}
+
+bool TransactionsGraph::removeTransactions_PositiveAll(Node& node, Component& component) {
+    if (node.balance_ >= kZeroBalance)
+        return true;
+
+    TransactionIndex* prevNext = &node.lastTrxInd_;
+
+    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
+        const Edge& edge = edges_[trxInd];
+
+        if (edge.amount > edge.target->balance_) {
+            prevNext = &trxList_[trxInd];
+            continue;
+        }
+
+        remove(node, prevNext, trxInd, component);
+
+        if (node.balance_ >= kZeroBalance) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TransactionsGraph::removeTransactions_NegativeOne(Node& node, Component& component) {
+    if (node.balance_ >= kZeroBalance)
+        return true;
+
+    const csdb::Amount absBalance = -node.balance_;
+    TransactionIndex* prevNext = &node.lastTrxInd_;
+
+    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
+        const Edge& edge = edges_[trxInd];
+
+        if (edge.cost < absBalance) {
+            prevNext = &trxList_[trxInd];
+            continue;
+        }
+
+        remove(node, prevNext, trxInd, component);
+
+        if (edge.target->balance_ < kZeroBalance)
+            component.negativeNodes.push_back(edge.target);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool TransactionsGraph::removeTransactions_NegativeAll(Node& node, Component& component) {
+    if (node.balance_ >= kZeroBalance)
+        return true;
+
+    TransactionIndex* prevNext = &node.lastTrxInd_;
+
+    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
+        const Edge& edge = edges_[trxInd];
+
+        remove(node, prevNext, trxInd, component);
+
+        if (edge.target->balance_ < kZeroBalance)
+            component.negativeNodes.push_back(edge.target);
+
+        if (node.balance_ >= kZeroBalance)
+            return true;
+    }
+
+    return false;
+}
+
+void TransactionsGraph::remove(Node& node, TransactionIndex* prevNext, TransactionIndex trxInd, Component& component) {
+    const Edge& edge = edges_[trxInd];
+
+    maskIncluded_[trxInd] = Reject::Reason::NegativeResult;
+
+    node.balance_ = node.balance_ + edge.amount + edge.fee;
+    edge.target->balance_ = edge.target->balance_ - edge.amount;
+
+    *prevNext = trxList_[trxInd];
+    trxList_[trxInd] = WalletsState::noInd_;
+
+    ++component.removed;
+}
+}  // namespace cs
@@ -107,12 +107,21 @@ TransactionsPacket TransactionsPacket::fromByteStream(const char* data, size_t s
     return res;
 }
 
+TransactionsPacketPtr TransactionsPacket::share(TransactionsPacket&& packet) {
+    auto shared = std::make_shared<TransactionsPacket>(std::move(packet));
+    shared->makeHash();
+    shared->binary_ = std::make_shared<const cs::Bytes>(shared->toBinary());
+
+    return shared;
+}
+
 TransactionsPacket::TransactionsPacket(TransactionsPacket&& packet)
 : hash_(std::move(packet.hash_))
 , transactions_(std::move(packet.transactions_))
 , stateTransactions_(std::move(packet.stateTransactions_))
 , signatures_(std::move(packet.signatures_))
-, expiredRound_(packet.expiredRound_) {
+, expiredRound_(packet.expiredRound_)
+, binary_(std::move(packet.binary_)) {
     packet.hash_ = TransactionsPacketHash();
     packet.transactions_.clear();
 }
@@ -127,6 +136,7 @@ TransactionsPacket& TransactionsPacket::operator=(const TransactionsPacket& pack
     signatures_ = packet.signatures_;
     stateTransactions_ = packet.stateTransactions_;
     expiredRound_ = packet.expiredRound_;
+    binary_ = packet.binary_;
 
     return *this;
 }
@@ -136,11 +146,19 @@ TransactionsPacket& TransactionsPacket::operator=(const TransactionsPacket& pack
 //
 
 cs::Bytes TransactionsPacket::toBinary(Serialization options) const noexcept {
+    if (binary_ && options == Serialization::All) {
+        return *binary_;
+    }
+
     ::csdb::priv::obstream os;
     put(os, options);
     return os.buffer();
 }
 
+const std::shared_ptr<const cs::Bytes>& TransactionsPacket::cachedBinary() const noexcept {
+    return binary_;
+}
+
 bool TransactionsPacket::makeHash() {
     bool isEmpty = isHashEmpty();
 
@@ -194,11 +212,13 @@ bool TransactionsPacket::addSignature(const cs::Byte index, const cs::Signature&
         return false;
     }
 
+    resetCache();
     signatures_.push_back(std::make_pair(index, signature));
     return true;
 }
 
 void TransactionsPacket::setExpiredRound(RoundNumber round) {
+    resetCache();
     expiredRound_ = round;
 }
 
@@ -215,6 +235,7 @@ bool TransactionsPacket::sign(const cs::PrivateKey& privateKey) {
         return false;
     }
 
+    resetCache();
     signatures_.push_back(std::make_pair(cs::Byte(0), cscrypto::generateSignature(privateKey, hash_.toBinary().data(), hash_.toBinary().size())));
     return true;
 }
@@ -277,10 +298,12 @@ const std::vector<csdb::Transaction>& TransactionsPacket::stateTransactions() co
 }
 
 std::vector<csdb::Transaction>& TransactionsPacket::transactions() {
+    resetCache();
     return transactions_;
 }
 
 void TransactionsPacket::clear() noexcept {
+    resetCache();
     transactions_.clear();
 }
 
@@ -321,6 +344,10 @@ void TransactionsPacket::put(::csdb::priv::obstream& os, Serialization options)
     }
 }
 
+void TransactionsPacket::resetCache() noexcept {
+    binary_.reset();
+}
+
 bool TransactionsPacket::get(::csdb::priv::ibstream& is) {
     cs::RoundNumber round = 0;
 
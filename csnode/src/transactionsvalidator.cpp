@@ -11,6 +11,7 @@
 #include <csdb/amount_commission.hpp>
 #include <lib/system/logger.hpp>
 #include <csnode/nodecore.hpp>
+#include <csnode/transactionsgraph.hpp>
 #include <smartcontracts.hpp>
 #include <solvercontext.hpp>
 #include <walletscache.hpp>
@@ -229,9 +230,9 @@ Reject::Reason TransactionsValidator::validateTransactionAsSource(SolverContext&
     if (delegateField.is_valid()) {
         WalletsState::WalletData& wallTargetState = walletsState_.getData(trx.target());
         auto tKey = trx.target().is_public_key() ? trx.target().public_key() : context.blockchain().getCacheUpdater().toPublicKey(trx.target());
-        auto itTarget = wallState.delegateTargets_.find(tKey);
+        auto delegateTarget = wallState.delegateTarget(tKey);
         auto sKey = trx. source().is_public_key() ? trx.source().public_key() : context.blockchain().getCacheUpdater().toPublicKey(trx.source());
-        auto itSource = wallTargetState.delegateSources_.find(sKey);
+        auto delegateSource = wallTargetState.delegateSource(sKey);
         if (delegateField.value<uint64_t>() == trx_uf::sp::de::legate || delegateField.value<uint64_t>() >= trx_uf::sp::de::legate_min_utc) {
              if (trx.amount() < Consensus::MinStakeDelegated) {
                 csdebug() << kLogPrefix << "The delegated amount is too low";
@@ -247,21 +248,21 @@ Reject::Reason TransactionsValidator::validateTransactionAsSource(SolverContext&
             }
         }
         else if (delegateField.value<uint64_t>() == trx_uf::sp::de::legated_withdraw) {
-            if (itTarget == wallState.delegateTargets_.end()) {
+            if (delegateTarget == nullptr) {
                 csdebug() << kLogPrefix << "No such target delegate in source account state";
                 return Reject::Reason::IncorrectTarget;
             }
             else {
 
-                if (itSource == wallTargetState.delegateSources_.end()) {
+                if (delegateSource == nullptr) {
                     cserror() << kLogPrefix << "No such delegate source in target records";
                     return Reject::Reason::IncorrectTarget;
                 }
                 else {
-                    auto itt = std::find_if(itTarget->second.begin(), itTarget->second.end(), [](cs::TimeMoney& tm) {return tm.time == cs::Zero::timeStamp; });
-                    auto its = std::find_if(itSource->second.begin(), itSource->second.end(), [](cs::TimeMoney& tm) {return tm.time == cs::Zero::timeStamp; });
-                    bool itt_found = itt != itTarget->second.end();
-                    bool its_found = its != itSource->second.end();
+                    auto itt = std::find_if(delegateTarget->begin(), delegateTarget->end(), [](const cs::TimeMoney& tm) {return tm.time == cs::Zero::timeStamp; });
+                    auto its = std::find_if(delegateSource->begin(), delegateSource->end(), [](const cs::TimeMoney& tm) {return tm.time == cs::Zero::timeStamp; });
+                    bool itt_found = itt != delegateTarget->end();
+                    bool its_found = its != delegateSource->end();
                     if (its_found && itt_found) {
                         if (itt->amount != its->amount) {
                             cserror() << kLogPrefix << "The sum of delegation is not properly set to the sender and target accounts";
@@ -397,213 +398,16 @@ size_t TransactionsValidator::makeSmartsValid(SolverContext& context, RejectedSm
 }
 
 void TransactionsValidator::validateByGraph(SolverContext& context, CharacteristicMask& maskIncluded, const Transactions& trxs) {
-    while (!negativeNodes_.empty()) {
-        Node& currNode = *negativeNodes_.back();
-        negativeNodes_.pop_back();
-
-        if (currNode.balance_ >= zeroBalance_) {
-            continue;
-        }
-
-        removeTransactions(context, currNode, trxs, maskIncluded);
-    }
-}
-
-void TransactionsValidator::removeTransactions(SolverContext& context, Node& node, const Transactions& trxs, CharacteristicMask& maskIncluded) {
-    if (removeTransactions_PositiveOne(context, node, trxs, maskIncluded)) {
-        return;
-    }
-    if (removeTransactions_PositiveAll(context, node, trxs, maskIncluded)) {
-        return;
-    }
-    if (removeTransactions_NegativeOne(context, node, trxs, maskIncluded)) {
-        return;
-    }
-    if (removeTransactions_NegativeAll(context, node, trxs, maskIncluded)) {
+    if (negativeNodes_.empty()) {
         return;
     }
 
-    csdebug() << "removeTransactions: Failed to make balance non-negative ";
-}
-
-bool TransactionsValidator::removeTransactions_PositiveOne(SolverContext& context, Node& node, const Transactions& trxs, CharacteristicMask& maskIncluded) {
-    if (node.balance_ >= zeroBalance_)
-        return true;
-
-    const csdb::Amount absBalance = -node.balance_;
-    TransactionIndex* prevNext = &node.lastTrxInd_;
     auto& smarts = context.smart_contracts();
+    TransactionsGraph graph(trxs, trxList_, maskIncluded);
 
-    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
-        const csdb::Transaction& trx = trxs[trxInd];
-
-        csdb::Amount trxCost = trx.amount().to_double();
-        if (smarts.is_known_smart_contract(trx.target())) {
-            trxCost += csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            trxCost += csdb::Amount(trx.counted_fee().to_double());
-        }
-
-        if (trxCost < absBalance) {
-            prevNext = &trxList_[trxInd];
-            continue;
-        }
-
-        Node& destNode = walletsState_.getData(trx.target());
-
-        const bool isTrxPositive = (trx.amount() <= destNode.balance_);
-
-        if (!isTrxPositive) {
-            prevNext = &trxList_[trxInd];
-            continue;
-        }
-
-        maskIncluded[trxInd] = Reject::Reason::NegativeResult;
-
-        if (smarts.is_known_smart_contract(trx.target())) {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.counted_fee().to_double());
-        }
-        destNode.balance_ = destNode.balance_ - trx.amount();
-
-        *prevNext = trxList_[trxInd];
-        trxList_[trxInd] = WalletsState::noInd_;
-
-        ++cntRemovedTrxs_;
-
-        return true;
-    }
-
-    return false;
-}
-
-bool TransactionsValidator::removeTransactions_PositiveAll(SolverContext& context, Node& node, const Transactions& trxs, CharacteristicMask& maskIncluded) {
-    if (node.balance_ >= zeroBalance_)
-        return true;
-
-    TransactionIndex* prevNext = &node.lastTrxInd_;
-    auto& smarts = context.smart_contracts();
-
-    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
-        const csdb::Transaction& trx = trxs[trxInd];
-
-        Node& destNode = walletsState_.getData(trx.target());
-        const bool isTrxPositive = (trx.amount() <= destNode.balance_);
-
-        if (!isTrxPositive) {
-            prevNext = &trxList_[trxInd];
-            continue;
-        }
-
-        maskIncluded[trxInd] = Reject::Reason::NegativeResult;
-
-        if (smarts.is_known_smart_contract(trx.target())) {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.counted_fee().to_double());
-        }
-        destNode.balance_ = destNode.balance_ - trx.amount();
-
-        *prevNext = trxList_[trxInd];
-        trxList_[trxInd] = WalletsState::noInd_;
-
-        ++cntRemovedTrxs_;
-
-        if (node.balance_ >= zeroBalance_) {
-            return true;
-        }
-    }
-
-    return false;
-}
-
-bool TransactionsValidator::removeTransactions_NegativeOne(SolverContext& context, Node& node, const Transactions& trxs, CharacteristicMask& maskIncluded) {
-    if (node.balance_ >= zeroBalance_)
-        return true;
-
-    const csdb::Amount absBalance = -node.balance_;
-    TransactionIndex* prevNext = &node.lastTrxInd_;
-    auto& smarts = context.smart_contracts();
-
-    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
-        const csdb::Transaction& trx = trxs[trxInd];
-        csdb::Amount trxCost = trx.amount().to_double();
-        if (smarts.is_known_smart_contract(trx.target())) {
-            trxCost += csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            trxCost += csdb::Amount(trx.counted_fee().to_double());
-        }
-
-        if (trxCost < absBalance) {
-            prevNext = &trxList_[trxInd];
-            continue;
-        }
-
-        Node& destNode = walletsState_.getData(trx.target());
-
-        maskIncluded[trxInd] = Reject::Reason::NegativeResult;
-
-        if (smarts.is_known_smart_contract(trx.target())) {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.counted_fee().to_double());
-        }
-        destNode.balance_ = destNode.balance_ - trx.amount();
-
-        *prevNext = trxList_[trxInd];
-        trxList_[trxInd] = WalletsState::noInd_;
-
-        ++cntRemovedTrxs_;
-
-        if (destNode.balance_ < zeroBalance_)
-            negativeNodes_.push_back(&destNode);
-
-        return true;
-    }
-    return false;
-}
-
-bool TransactionsValidator::removeTransactions_NegativeAll(SolverContext& context, Node& node, const Transactions& trxs, CharacteristicMask& maskIncluded) {
-    if (node.balance_ >= zeroBalance_)
-        return true;
-
-    TransactionIndex* prevNext = &node.lastTrxInd_;
-    auto& smarts = context.smart_contracts();
-
-    for (TransactionIndex trxInd = *prevNext; trxInd != WalletsState::noInd_; trxInd = *prevNext) {
-        const csdb::Transaction& trx = trxs[trxInd];
-
-        Node& destNode = walletsState_.getData(trx.target());
-
-        maskIncluded[trxInd] = Reject::Reason::NegativeResult;
-
-        if (smarts.is_known_smart_contract(trx.target())) {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.max_fee().to_double());
-        }
-        else {
-            node.balance_ = node.balance_ + trx.amount() + csdb::Amount(trx.counted_fee().to_double());
-        }
-        destNode.balance_ = destNode.balance_ - trx.amount();
-
-        *prevNext = trxList_[trxInd];
-        trxList_[trxInd] = WalletsState::noInd_;
-
-        ++cntRemovedTrxs_;
-
-        if (destNode.balance_ < zeroBalance_)
-            negativeNodes_.push_back(&destNode);
-
-        if (node.balance_ >= zeroBalance_)
-            return true;
-    }
-
-    return false;
+    cntRemovedTrxs_ += graph.resolve(negativeNodes_, [&](const csdb::Address& target) {
+        return TransactionsGraph::Target{&walletsState_.getData(target), smarts.is_known_smart_contract(target)};
+    });
 }
 
 bool TransactionsValidator::duplicatedNewState(SolverContext& context, const csdb::Address& addr) const {
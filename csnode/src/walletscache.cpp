@@ -35,8 +35,12 @@ std::unique_ptr<WalletsCache::Updater> WalletsCache::createUpdater() {
 WalletsCache::Updater::Updater(WalletsCache& data) : data_(data) {}
 
 PublicKey WalletsCache::Updater::toPublicKey(const csdb::Address& addr) const {
+    // default constructed address allocates, it is not needed for public key one
+    if (addr.is_public_key()) {
+        return addr.public_key();
+    }
     csdb::Address res;
-    if (addr.is_public_key() || !data_.walletsIds_.normal().findaddr(addr.wallet_id(), res)) {
+    if (!data_.walletsIds_.normal().findaddr(addr.wallet_id(), res)) {
         return addr.public_key();
     }
     return res.public_key();
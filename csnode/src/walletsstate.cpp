@@ -4,26 +4,45 @@ namespace cs {
 
 WalletsState::WalletData& WalletsState::getData(const WalletAddress& address) {
     auto pubKey = wallCache_.toPublicKey(address);
-    auto it = storage_.find(pubKey);
-    if (it != storage_.end()) {
-        return it->second;
+    auto& entry = index_[pubKey];
+
+    if (entry.round == round_) {
+        return *entry.data;
+    }
+
+    entry.round = round_;
+    entry.data = allocate();
+
+    WalletData& data = *entry.data;
+    auto walletPtr = wallCache_.findWallet(pubKey);
+
+    if (walletPtr) {
+        data = WalletData{noInd_, walletPtr->balance_, walletPtr->delegated_, walletPtr->trxTail_, walletPtr};
     }
     else {
-        auto walletPtr = wallCache_.findWallet(address);
-        if (walletPtr) {
-            auto res = storage_.insert(std::make_pair(pubKey,
-                                                      WalletData{noInd_,
-                                                                 walletPtr->balance_,
-                                                                 walletPtr->delegated_,
-                                                                 walletPtr->delegateSources_ ? *walletPtr->delegateSources_ : std::map<cs::PublicKey, std::vector<cs::TimeMoney>>{},// accounts, delegated to current account
-                                                                 walletPtr->delegateTargets_ ? *walletPtr->delegateTargets_ : std::map<cs::PublicKey, std::vector<cs::TimeMoney>>{},// accounts to which current round delegated special amounts 
-                                                                 walletPtr->trxTail_}));
-            return res.first->second;
-        }
-        else {
-            auto res = storage_.insert(std::make_pair(pubKey, WalletData{noInd_}));
-            return res.first->second;
-        }
+        data = WalletData{noInd_};
     }
+
+    return data;
+}
+
+void WalletsState::updateFromSource() {
+    ++round_;
+    used_ = 0;
+
+    if (index_.size() > kMaxIndexSize) {
+        index_.clear();
+    }
+}
+
+WalletsState::WalletData* WalletsState::allocate() {
+    if (used_ == chunks_.size() * kChunkSize) {
+        chunks_.push_back(std::make_unique<WalletData[]>(kChunkSize));
+    }
+
+    WalletData* data = &chunks_[used_ / kChunkSize][used_ % kChunkSize];
+    ++used_;
+
+    return data;
 }
 }  // namespace cs
@@ -101,6 +101,12 @@ class hash<cs::PublicKey> {
 public:
     size_t operator()(const cs::PublicKey& key) const;
 };
+
+template<>
+class hash<cs::Signature> {
+public:
+    size_t operator()(const cs::Signature& signature) const;
+};
 } // namespace std
 
 #endif  // COMMON_HPP
@@ -2,6 +2,7 @@
 #define CONCURRENT_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <future>
@@ -388,6 +389,61 @@ public:
         Worker::execute(policy, std::forward<Func>(function));
     }
 
+    // calls func(index) for each index in [0, count) by chunks of minChunk indexes at least,
+    // chunks are processed by thread pool and calling thread, blocks until all chunks are done.
+    // Calling thread takes part in processing, so it is safe to call it from thread pool
+    template <typename Func>
+    static void parallelFor(size_t count, size_t minChunk, const Func& func) {
+        if (count == 0) {
+            return;
+        }
+
+        const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t chunk = std::max((count + threads - 1) / threads, std::max(minChunk, size_t(1)));
+        const size_t chunks = (count + chunk - 1) / chunk;
+
+        if (chunks == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+
+            return;
+        }
+
+        struct State {
+            std::atomic<size_t> next{0};
+            std::atomic<size_t> done{0};
+            std::mutex mutex;
+            std::condition_variable condition;
+        };
+
+        // late pool tasks find no chunks left and touch only shared state
+        auto state = std::make_shared<State>();
+        auto worker = [state, count, chunk, chunks, &func] {
+            for (size_t index = state->next.fetch_add(1); index < chunks; index = state->next.fetch_add(1)) {
+                const size_t end = std::min((index + 1) * chunk, count);
+
+                for (size_t i = index * chunk; i < end; ++i) {
+                    func(i);
+                }
+
+                if (state->done.fetch_add(1) + 1 == chunks) {
+                    cs::Lock lock(state->mutex);
+                    state->condition.notify_all();
+                }
+            }
+        };
+
+        for (size_t i = 1; i < chunks; ++i) {
+            Worker::execute(worker);
+        }
+
+        worker();
+
+        std::unique_lock lock(state->mutex);
+        state->condition.wait(lock, [&] { return state->done.load() == chunks; });
+    }
+
 private:
     static void runAfterHelper(const std::chrono::steady_clock::time_point& timePoint, cs::RunPolicy policy, std::function<void()> callBack) {
         std::this_thread::sleep_until(timePoint);
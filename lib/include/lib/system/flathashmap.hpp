@@ -0,0 +1,575 @@
+#ifndef FLATHASHMAP_HPP
+#define FLATHASHMAP_HPP
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CS_FLAT_HASH_MAP_SSE2
+#endif
+
+namespace cs {
+///
+/// Open addressing hash map specialised for fixed size binary keys (public keys, hashes).
+/// Key prefix bits are used as hash directly (mixed with process seed to resist crafted keys),
+/// control bytes are probed by groups of 16 with SSE2 where available.
+///
+/// Values are stored in stable storage, so references and pointers to values are not
+/// invalidated by insertion or rehash (std::unordered_map guarantee), only by erase of this element.
+/// Iteration order is not specified. Not thread safe.
+///
+template <typename Key, typename Value>
+class FlatHashMap {
+    static_assert(std::is_trivially_copyable_v<Key>, "FlatHashMap key must be trivially copyable");
+    static_assert(sizeof(Key) >= sizeof(uint64_t), "FlatHashMap key must contain at least 8 bytes");
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+
+private:
+    using Element = std::optional<value_type>;
+
+    template <bool IsConst>
+    class Iterator {
+        using MapPointer = std::conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        Iterator(MapPointer map, size_type index)
+        : map_(map)
+        , index_(index) {
+            skip();
+        }
+
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other)
+        : map_(other.map_)
+        , index_(other.index_) {
+        }
+
+        reference operator*() const {
+            return *map_->element(index_);
+        }
+
+        pointer operator->() const {
+            return &(*map_->element(index_));
+        }
+
+        Iterator& operator++() {
+            ++index_;
+            skip();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return index_ != other.index_;
+        }
+
+    private:
+        void skip() {
+            while (index_ < map_->used_ && !map_->element(index_).has_value()) {
+                ++index_;
+            }
+        }
+
+        MapPointer map_ = nullptr;
+        size_type index_ = 0;
+
+        template <bool>
+        friend class Iterator;
+        friend class FlatHashMap;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap()
+    : seed_(generateSeed()) {
+    }
+
+    explicit FlatHashMap(size_type count)
+    : FlatHashMap() {
+        reserve(count);
+    }
+
+    FlatHashMap(const FlatHashMap& other)
+    : FlatHashMap() {
+        reserve(other.size());
+
+        for (const auto& element : other) {
+            emplace(element.first, element.second);
+        }
+    }
+
+    // moved from map is left empty and usable
+    FlatHashMap(FlatHashMap&& other) noexcept
+    : ctrl_(std::move(other.ctrl_))
+    , slots_(std::move(other.slots_))
+    , chunks_(std::move(other.chunks_))
+    , free_(std::move(other.free_))
+    , used_(other.used_)
+    , size_(other.size_)
+    , deleted_(other.deleted_)
+    , seed_(other.seed_) {
+        other.clear();
+    }
+
+    FlatHashMap& operator=(const FlatHashMap& other) {
+        if (this != &other) {
+            FlatHashMap copy(other);
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+        if (this != &other) {
+            ctrl_ = std::move(other.ctrl_);
+            slots_ = std::move(other.slots_);
+            chunks_ = std::move(other.chunks_);
+            free_ = std::move(other.free_);
+            used_ = other.used_;
+            size_ = other.size_;
+            deleted_ = other.deleted_;
+            seed_ = other.seed_;
+
+            other.clear();
+        }
+
+        return *this;
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, used_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, used_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type capacity() const noexcept {
+        return ctrl_.size();
+    }
+
+    ///
+    /// @brief Returns approximate count of heap bytes used by map.
+    ///
+    size_type memoryUsage() const noexcept {
+        return ctrl_.capacity() * sizeof(int8_t) + slots_.capacity() * sizeof(uint32_t) + chunks_.capacity() * sizeof(ChunkPointer) +
+               chunks_.size() * kChunkSize * sizeof(Element) + free_.capacity() * sizeof(uint32_t);
+    }
+
+    void clear() {
+        ctrl_.clear();
+        slots_.clear();
+        chunks_.clear();
+        free_.clear();
+        used_ = 0;
+        size_ = 0;
+        deleted_ = 0;
+    }
+
+    void reserve(size_type count) {
+        if (count > maxLoad(ctrl_.size())) {
+            rehash(capacityFor(count));
+        }
+    }
+
+    iterator find(const Key& key) {
+        const size_type index = findIndex(key);
+        return index == kNotFound ? end() : makeIterator(index);
+    }
+
+    const_iterator find(const Key& key) const {
+        const size_type index = findIndex(key);
+        return index == kNotFound ? end() : makeIterator(index);
+    }
+
+    bool contains(const Key& key) const {
+        return findIndex(key) != kNotFound;
+    }
+
+    size_type count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    ///
+    /// @brief Returns value by key.
+    /// @throws std::out_of_range if key is not in map, as std::unordered_map::at does.
+    ///
+    Value& at(const Key& key) {
+        return element(checkedIndex(key))->second;
+    }
+
+    const Value& at(const Key& key) const {
+        return element(checkedIndex(key))->second;
+    }
+
+    Value& operator[](const Key& key) {
+        return tryEmplace(key).first->second;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> tryEmplace(const Key& key, Args&&... args) {
+        const uint64_t hash = mix(loadPrefix(key));
+
+        if (size_type index = findIndex(key, hash); index != kNotFound) {
+            return std::make_pair(makeIterator(index), false);
+        }
+
+        if (size_ + deleted_ + 1 > maxLoad(ctrl_.size())) {
+            // drop tombstones if they occupy a lot of table, otherwise grow
+            rehash(size_ + 1 > maxLoad(ctrl_.size()) / 2 ? capacityFor(size_ + 1) : ctrl_.size());
+        }
+
+        const size_type index = allocateValue(key, std::forward<Args>(args)...);
+        insertSlot(hash, static_cast<uint32_t>(index));
+        ++size_;
+
+        return std::make_pair(makeIterator(index), true);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        return tryEmplace(key, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return tryEmplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return tryEmplace(value.first, std::move(value.second));
+    }
+
+    size_type erase(const Key& key) {
+        const size_type slot = findSlot(key, mix(loadPrefix(key)));
+
+        if (slot == kNotFound) {
+            return 0;
+        }
+
+        const uint32_t index = slots_[slot];
+
+        ctrl_[slot] = kDeleted;
+        ++deleted_;
+        --size_;
+
+        element(index).reset();
+        free_.push_back(index);
+
+        return 1;
+    }
+
+    iterator erase(const_iterator position) {
+        const size_type index = position.index_;
+        erase(position->first);
+
+        return makeIterator(index);
+    }
+
+    void swap(FlatHashMap& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(chunks_, other.chunks_);
+        std::swap(free_, other.free_);
+        std::swap(used_, other.used_);
+        std::swap(size_, other.size_);
+        std::swap(deleted_, other.deleted_);
+        std::swap(seed_, other.seed_);
+    }
+
+private:
+    enum : int8_t {
+        kEmpty = -128,
+        kDeleted = -2
+    };
+
+    static constexpr size_type kGroupWidth = 16;
+    static constexpr size_type kChunkSize = 1024;
+    static constexpr size_type kNotFound = std::numeric_limits<size_type>::max();
+
+    using ChunkPointer = std::unique_ptr<Element[]>;
+
+    Element& element(size_type index) {
+        return chunks_[index / kChunkSize][index % kChunkSize];
+    }
+
+    const Element& element(size_type index) const {
+        return chunks_[index / kChunkSize][index % kChunkSize];
+    }
+
+    static uint64_t loadPrefix(const Key& key) noexcept {
+        uint64_t prefix;
+        std::memcpy(&prefix, &key, sizeof(prefix));
+        return prefix;
+    }
+
+    uint64_t mix(uint64_t prefix) const noexcept {
+        uint64_t hash = prefix ^ seed_;
+        hash ^= hash >> 32;
+        hash *= 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 29;
+        return hash;
+    }
+
+    static int8_t tag(uint64_t hash) noexcept {
+        return static_cast<int8_t>(hash >> 57);
+    }
+
+    static uint64_t generateSeed() {
+        static const uint64_t seed = std::random_device{}() * 0x100000001b3ull ^ std::random_device{}();
+        return seed;
+    }
+
+    static size_type maxLoad(size_type capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    static size_type capacityFor(size_type count) noexcept {
+        size_type capacity = kGroupWidth;
+
+        while (maxLoad(capacity) < count) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+
+#ifdef CS_FLAT_HASH_MAP_SSE2
+    static uint32_t match(const int8_t* group, int8_t value) noexcept {
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+    }
+
+    static uint32_t matchEmptyOrDeleted(const int8_t* group) noexcept {
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+    }
+#else
+    static uint32_t match(const int8_t* group, int8_t value) noexcept {
+        uint32_t mask = 0;
+
+        for (size_type i = 0; i < kGroupWidth; ++i) {
+            mask |= static_cast<uint32_t>(group[i] == value) << i;
+        }
+
+        return mask;
+    }
+
+    static uint32_t matchEmptyOrDeleted(const int8_t* group) noexcept {
+        uint32_t mask = 0;
+
+        for (size_type i = 0; i < kGroupWidth; ++i) {
+            mask |= static_cast<uint32_t>(group[i] < 0) << i;
+        }
+
+        return mask;
+    }
+#endif
+
+    static size_type lowestBit(uint32_t mask) noexcept {
+        size_type index = 0;
+
+        while ((mask & 1u) == 0) {
+            mask >>= 1;
+            ++index;
+        }
+
+        return index;
+    }
+
+    size_type groupMask() const noexcept {
+        return ctrl_.size() / kGroupWidth - 1;
+    }
+
+    size_type findSlot(const Key& key, uint64_t hash) const {
+        if (ctrl_.empty()) {
+            return kNotFound;
+        }
+
+        const int8_t h2 = tag(hash);
+        const size_type mask = groupMask();
+        size_type group = static_cast<size_type>(hash) & mask;
+
+        for (size_type step = 1; step <= mask + 1; ++step) {
+            const int8_t* ctrl = ctrl_.data() + group * kGroupWidth;
+
+            for (uint32_t matches = match(ctrl, h2); matches != 0; matches &= matches - 1) {
+                const size_type slot = group * kGroupWidth + lowestBit(matches);
+
+                if (element(slots_[slot])->first == key) {
+                    return slot;
+                }
+            }
+
+            if (match(ctrl, kEmpty) != 0) {
+                break;
+            }
+
+            group = (group + step) & mask;
+        }
+
+        return kNotFound;
+    }
+
+    size_type findIndex(const Key& key, uint64_t hash) const {
+        const size_type slot = findSlot(key, hash);
+        return slot == kNotFound ? kNotFound : slots_[slot];
+    }
+
+    size_type findIndex(const Key& key) const {
+        return findIndex(key, mix(loadPrefix(key)));
+    }
+
+    size_type checkedIndex(const Key& key) const {
+        const size_type index = findIndex(key);
+
+        if (index == kNotFound) {
+            throw std::out_of_range("FlatHashMap::at: key is not found");
+        }
+
+        return index;
+    }
+
+    void insertSlot(uint64_t hash, uint32_t index) {
+        const size_type mask = groupMask();
+        size_type group = static_cast<size_type>(hash) & mask;
+
+        for (size_type step = 1;; ++step) {
+            const uint32_t available = matchEmptyOrDeleted(ctrl_.data() + group * kGroupWidth);
+
+            if (available != 0) {
+                const size_type slot = group * kGroupWidth + lowestBit(available);
+
+                if (ctrl_[slot] == kDeleted) {
+                    --deleted_;
+                }
+
+                ctrl_[slot] = tag(hash);
+                slots_[slot] = index;
+                return;
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    template <typename... Args>
+    size_type allocateValue(const Key& key, Args&&... args) {
+        size_type index;
+
+        if (!free_.empty()) {
+            index = free_.back();
+            free_.pop_back();
+        }
+        else {
+            if (used_ == chunks_.size() * kChunkSize) {
+                chunks_.push_back(std::make_unique<Element[]>(kChunkSize));
+            }
+
+            index = used_++;
+        }
+
+        element(index).emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        return index;
+    }
+
+    void rehash(size_type capacity) {
+        std::vector<int8_t> oldCtrl(capacity, kEmpty);
+        std::vector<uint32_t> oldSlots(capacity);
+
+        oldCtrl.swap(ctrl_);
+        oldSlots.swap(slots_);
+        deleted_ = 0;
+
+        for (size_type slot = 0; slot < oldCtrl.size(); ++slot) {
+            if (oldCtrl[slot] >= 0) {
+                const uint32_t index = oldSlots[slot];
+                insertSlot(mix(loadPrefix(element(index)->first)), index);
+            }
+        }
+    }
+
+    iterator makeIterator(size_type index) {
+        return iterator(this, index);
+    }
+
+    const_iterator makeIterator(size_type index) const {
+        return const_iterator(this, index);
+    }
+
+    // control bytes: empty, deleted or 7 bits tag of full slot
+    std::vector<int8_t> ctrl_;
+    // indexes of elements in chunks
+    std::vector<uint32_t> slots_;
+
+    // stable elements storage, freed elements are reused
+    std::vector<ChunkPointer> chunks_;
+    std::vector<uint32_t> free_;
+    size_type used_ = 0;
+
+    size_type size_ = 0;
+    size_type deleted_ = 0;
+    uint64_t seed_ = 0;
+};
+}  // namespace cs
+
+#endif  // FLATHASHMAP_HPP
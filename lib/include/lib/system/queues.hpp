@@ -2,7 +2,9 @@
 #ifndef QUEUES_HPP
 #define QUEUES_HPP
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <thread>
 
 #include "cache.hpp"
@@ -99,4 +101,92 @@ private:
     __cacheline_aligned std::atomic<Element*> writingBarrier_ = {elements};
 };
 
+/* Bounded MPSC queue is a preallocated ring buffer that allows many writers
+   and one reader, each cell sequence tells whose turn it is */
+template <typename T>
+class MPSCQueue {
+public:
+    explicit MPSCQueue(size_t capacity)
+    : mask_(roundUp(capacity) - 1)
+    , cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // returns false if queue is full, value stays untouched
+    bool push(T&& value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        while (true) {
+            cell = &cells_[pos & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // reader only
+    bool pop(T& value) {
+        Cell& cell = cells_[head_ & mask_];
+
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return false;
+        }
+
+        value = std::move(cell.value);
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+
+        return true;
+    }
+
+    // reader only
+    bool empty() const {
+        return cells_[head_ & mask_].sequence.load(std::memory_order_acquire) != head_ + 1;
+    }
+
+    size_t capacity() const {
+        return mask_ + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t roundUp(size_t capacity) {
+        size_t result = 2;
+
+        while (result < capacity) {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    __cacheline_aligned std::atomic<size_t> tail_ = {0};
+    __cacheline_aligned size_t head_ = 0;
+};
+
 #endif  // QUEUES_HPP
@@ -1,9 +1,20 @@
 #ifndef SIGNALS_HPP
 #define SIGNALS_HPP
 
-#include <functional>
 #include <algorithm>
-
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <lib/system/cache.hpp>
 #include <lib/system/common.hpp>
 #include <lib/system/reflection.hpp>
 
@@ -34,6 +45,8 @@ public:
 class IConnectable {
 protected:
     ~IConnectable() {
+        cs::Lock lock(mutex_);
+
         for (auto signal : signals_) {
             if (signal != nullptr) {
                 cshelper::ConnectorForwarder::disconnect(signal, this);
@@ -42,10 +55,346 @@ protected:
     }
 
 private:
+    std::mutex mutex_;
     std::vector<ISignal*> signals_;
     friend class Connector;
 };
 
+namespace cshelper {
+template <typename T>
+class Delegate;
+
+///
+/// Type erased callable like std::function, but callables up to kBufferSize bytes
+/// are stored inside, so object method slots and small closures never allocate.
+///
+template <typename Return, typename... InArgs>
+class Delegate<Return(InArgs...)> {
+    template <typename F>
+    using EnableIfCallable = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Delegate> && std::is_invocable_r_v<Return, std::decay_t<F>&, InArgs...>>;
+
+public:
+    // object pointer and method pointer with the largest (virtual base) representation
+    constexpr static size_t kBufferSize = 4 * sizeof(void*);
+
+    Delegate() = default;
+
+    template <typename F, typename = EnableIfCallable<F>>
+    Delegate(F&& func) {
+        using Functor = std::decay_t<F>;
+
+        if constexpr (std::is_constructible_v<bool, const Functor&>) {
+            if (!static_cast<bool>(func)) {
+                return;
+            }
+        }
+
+        if constexpr (isLocal<Functor>()) {
+            new (&storage_) Functor(std::forward<F>(func));
+        }
+        else {
+            *reinterpret_cast<Functor**>(&storage_) = new Functor(std::forward<F>(func));
+        }
+
+        invoke_ = &Delegate::invoke<Functor>;
+        manage_ = &Delegate::manage<Functor>;
+        type_ = &typeid(Functor);
+    }
+
+    Delegate(const Delegate& delegate)
+    : invoke_(delegate.invoke_)
+    , manage_(delegate.manage_)
+    , type_(delegate.type_) {
+        if (manage_) {
+            manage_(Operation::Copy, storage_, delegate.storage_);
+        }
+    }
+
+    Delegate(Delegate&& delegate) noexcept
+    : invoke_(delegate.invoke_)
+    , manage_(delegate.manage_)
+    , type_(delegate.type_) {
+        if (manage_) {
+            manage_(Operation::Move, storage_, delegate.storage_);
+            delegate.reset();
+        }
+    }
+
+    Delegate& operator=(const Delegate& delegate) {
+        if (this != &delegate) {
+            Delegate copy(delegate);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    Delegate& operator=(Delegate&& delegate) noexcept {
+        if (this != &delegate) {
+            clear();
+
+            if (delegate.manage_) {
+                delegate.manage_(Operation::Move, storage_, delegate.storage_);
+            }
+
+            invoke_ = delegate.invoke_;
+            manage_ = delegate.manage_;
+            type_ = delegate.type_;
+            delegate.reset();
+        }
+
+        return *this;
+    }
+
+    ~Delegate() {
+        clear();
+    }
+
+    explicit operator bool() const noexcept {
+        return invoke_ != nullptr;
+    }
+
+    Return operator()(InArgs... args) const {
+        return invoke_(storage_, std::forward<InArgs>(args)...);
+    }
+
+    // type of stored callable, as std::function::target_type
+    const std::type_info& targetType() const noexcept {
+        return type_ ? *type_ : typeid(void);
+    }
+
+    template <typename F>
+    const F* target() const noexcept {
+        if (!type_ || *type_ != typeid(F)) {
+            return nullptr;
+        }
+
+        return &access<F>(storage_);
+    }
+
+private:
+    using Storage = std::aligned_storage_t<kBufferSize, alignof(void*)>;
+
+    enum class Operation {
+        Copy,
+        Move,
+        Destroy
+    };
+
+    template <typename F>
+    constexpr static bool isLocal() {
+        return sizeof(F) <= sizeof(Storage) && alignof(Storage) % alignof(F) == 0 && std::is_nothrow_move_constructible_v<F>;
+    }
+
+    template <typename F>
+    static F& access(const Storage& storage) {
+        if constexpr (isLocal<F>()) {
+            return *const_cast<F*>(reinterpret_cast<const F*>(&storage));
+        }
+        else {
+            return **reinterpret_cast<F* const*>(&storage);
+        }
+    }
+
+    template <typename F>
+    static Return invoke(const Storage& storage, InArgs&&... args) {
+        return std::invoke(access<F>(storage), std::forward<InArgs>(args)...);
+    }
+
+    template <typename F>
+    static void manage(Operation operation, Storage& destination, const Storage& source) {
+        switch (operation) {
+            case Operation::Copy:
+                if constexpr (isLocal<F>()) {
+                    new (&destination) F(access<F>(source));
+                }
+                else {
+                    *reinterpret_cast<F**>(&destination) = new F(access<F>(source));
+                }
+                break;
+
+            case Operation::Move:
+                if constexpr (isLocal<F>()) {
+                    new (&destination) F(std::move(access<F>(source)));
+                    access<F>(source).~F();
+                }
+                else {
+                    *reinterpret_cast<F**>(&destination) = &access<F>(source);
+                }
+                break;
+
+            case Operation::Destroy:
+                if constexpr (isLocal<F>()) {
+                    access<F>(destination).~F();
+                }
+                else {
+                    delete &access<F>(destination);
+                }
+                break;
+        }
+    }
+
+    void clear() noexcept {
+        if (manage_) {
+            manage_(Operation::Destroy, storage_, storage_);
+        }
+
+        reset();
+    }
+
+    // forgets callable without destroying it
+    void reset() noexcept {
+        invoke_ = nullptr;
+        manage_ = nullptr;
+        type_ = nullptr;
+    }
+
+    Storage storage_;
+    Return (*invoke_)(const Storage&, InArgs&&...) = nullptr;
+    void (*manage_)(Operation, Storage&, const Storage&) = nullptr;
+    const std::type_info* type_ = nullptr;
+};
+
+///
+/// Epoch based reclamation of slot arrays of all signals. Emitting thread publishes global epoch
+/// in a record of its own, so emission does not write memory shared with other threads.
+/// An array replaced at epoch E is freed when each thread is out of emission or has published
+/// an epoch after E: by connection change or, if an emission could read it, by the last one.
+/// Arrays waiting for emissions are kept in lock free stack, so connection changes of different
+/// signals do not wait for each other.
+/// Where the system has a process wide memory barrier, the writer side issues it, so the emitting
+/// thread publishes its epoch by a plain store.
+///
+class Reclaimer {
+    struct __cacheline_aligned Record {
+        std::atomic<uint64_t> epoch = kQuiescent;
+        std::atomic<bool> used = true;
+        Record* next = nullptr;
+    };
+
+    using Destroy = void (*)(const void*);
+
+    struct Retired {
+        uint64_t epoch;
+        const void* object;
+        Destroy destroy;
+        Retired* next;
+    };
+
+public:
+    constexpr static uint64_t kQuiescent = std::numeric_limits<uint64_t>::max();
+
+    // keeps arrays read by emission alive, nested emissions of a thread keep the outer epoch
+    class Guard {
+    public:
+        Guard()
+        : record_(local())
+        , outer_(record_.epoch.load(std::memory_order_relaxed) == kQuiescent) {
+            if (outer_) {
+                const uint64_t epoch = epoch_.load(std::memory_order_acquire);
+
+                // store is ordered before the following array read, see retire()
+                if (asymmetric_.load(std::memory_order_acquire)) {
+                    record_.epoch.store(epoch, std::memory_order_relaxed);
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                }
+                else {
+                    record_.epoch.store(epoch, std::memory_order_seq_cst);
+                }
+            }
+        }
+
+        ~Guard() {
+            if (outer_) {
+                record_.epoch.store(kQuiescent, std::memory_order_release);
+
+                if (deferred_.load(std::memory_order_relaxed)) {
+                    collect();
+                }
+            }
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Record& record_;
+        const bool outer_;
+    };
+
+    // object must be unreachable for emissions started after the call, returns true if no emission
+    // can read it and caller frees it, otherwise it is freed by the last emission which can
+    template <typename T>
+    static bool retire(const T* object) {
+        return retire(object, [](const void* ptr) { delete static_cast<const T*>(ptr); });
+    }
+
+    // frees deferred objects no emission can read, the ones retired during running emissions wait for them
+    static void collect();
+
+private:
+    // returns record of thread for reuse when thread exits
+    struct Owner;
+
+    static bool retire(const void* object, Destroy destroy);
+
+    // makes epochs published by emissions which could read objects retired up to epoch visible to the caller
+    static void synchronize(uint64_t epoch);
+
+    // the oldest epoch published by running emissions
+    static uint64_t oldestEpoch();
+
+    // barrier is registered once, emissions switch to plain store after it
+    static bool isAsymmetric();
+
+    // pushes chain of retired objects to deferred stack
+    static void defer(Retired* first, Retired* last);
+
+    // plain thread local pointer is read without initialization check
+    static Record& local() {
+        if (!local_) {
+            local_ = acquire();
+        }
+
+        return *local_;
+    }
+
+    // takes record released by finished thread or adds a new one
+    static Record* acquire();
+
+    inline static std::atomic<uint64_t> epoch_ = 0;
+    inline static std::atomic<bool> asymmetric_ = false;
+
+    // epoch read before the latest finished barrier, the barrier covers all objects retired before the read
+    inline static std::atomic<uint64_t> barrierEpoch_ = 0;
+
+    // objects retired during emissions, taken whole by collector, so stack has no ABA
+    inline static std::atomic<Retired*> deferred_ = nullptr;
+
+    // records are never freed, so oldestEpoch() walks the list without lock
+    inline static std::atomic<Record*> head_ = nullptr;
+    inline static thread_local Record* local_ = nullptr;
+};
+
+// object method slot, extra signal arguments are dropped as std::bind does
+template <typename Object, typename Method, size_t Count>
+struct MethodSlot {
+    Object object;
+    Method method;
+
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) const {
+        return call(std::make_index_sequence<Count>(), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+private:
+    template <size_t... Indexes, typename Tuple>
+    decltype(auto) call(std::index_sequence<Indexes...>, Tuple&& arguments) const {
+        return std::invoke(method, object, std::get<Indexes>(std::forward<Tuple>(arguments))...);
+    }
+};
+}  // namespace cshelper
+
 ///
 /// Base preudo signal
 ///
@@ -53,14 +402,25 @@ template <typename T>
 class Signal;
 
 ///
-/// Signal needed specialization
+/// Signal needed specialization.
+/// Slots are kept in immutable array replaced on every connection change (copy on write),
+/// so emission does not lock and never sees a half changed array, connections from other
+/// threads or from slots are allowed. Replaced arrays are freed by cshelper::Reclaimer when
+/// emissions which could read them are finished, connection changes lock only their signal.
+/// Slot disconnected concurrently may still be called by emission started before.
 ///
 template <typename Return, typename... InArgs>
 class Signal<Return(InArgs...)> : public ISignal {
 public:
-    using Argument = std::function<Return(InArgs...)>;
+    using Argument = cshelper::Delegate<Return(InArgs...)>;
     using Signature = Return(InArgs...);
-    using Slots = std::vector<std::pair<ObjectPointer, Argument>>;
+
+    struct Slot {
+        ObjectPointer object;
+        Argument delegate;
+    };
+
+    using Slots = std::vector<Slot>;
 
     ///
     /// @brief Generates signal.
@@ -68,10 +428,15 @@ public:
     ///
     template <typename... Args>
     inline void operator()(Args&&... args) const {
-        for ([[maybe_unused]] auto& [obj, func] : slots_) {
-            csunused(obj);
-            if (func) {
-                func(std::forward<Args>(args)...);
+        if (slots_.load(std::memory_order_relaxed) == nullptr) {
+            return;
+        }
+
+        cshelper::Reclaimer::Guard guard;
+
+        if (const Slots* array = slots_.load()) {
+            for (const auto& slot : *array) {
+                slot.delegate(args...);
             }
         }
     }
@@ -81,69 +446,122 @@ public:
     Signal& operator=(const Signal&) = delete;
 
     Signal(Signal&& signal) noexcept
-    : slots_(std::move(signal.slots_)) {
-        signal.slots_.clear();
+    : slots_(signal.slots_.exchange(nullptr)) {
     }
 
     Signal& operator=(Signal&& signal) noexcept {
-        slots_ = std::move(signal.slots_);
-        signal.slots_.clear();
+        if (this != &signal) {
+            delete slots_.exchange(signal.slots_.exchange(nullptr));
+        }
 
         return *this;
     }
 
+    // signal is not emitted while it is destroyed
     ~Signal() {
-        (*this) = nullptr;
+        delete slots_.exchange(nullptr);
     }
 
 private:
     // adds slot to signal
-    template <typename T>
-    auto& add(T&& s, ObjectPointer obj = nullptr) {
-        Argument arg = std::move(s);
-
-        if (!arg) {
+    auto& add(Argument&& delegate, ObjectPointer obj = nullptr) {
+        if (!delegate) {
             return *this;
         }
 
-        slots_.push_back(std::make_pair(obj, std::move(arg)));
+        std::unique_ptr<const Slots> freed;
+        cs::Lock lock(mutex_);
+        const Slots* current = slots_.load();
+
+        auto array = new Slots();
+        array->reserve((current ? current->size() : 0) + 1);
+
+        if (current) {
+            array->insert(array->end(), current->begin(), current->end());
+        }
+
+        array->push_back(Slot{obj, std::move(delegate)});
+        replace(array, freed);
+
         return *this;
     }
 
+    // removes first or all slots matched by predicate, returns true if any is removed
+    template <typename Predicate>
+    bool remove(Predicate predicate, bool all) {
+        std::unique_ptr<const Slots> freed;
+        cs::Lock lock(mutex_);
+        const Slots* current = slots_.load();
+
+        if (!current) {
+            return false;
+        }
+
+        auto array = new Slots();
+        array->reserve(current->size());
+
+        bool removed = false;
+
+        for (const auto& slot : *current) {
+            if ((all || !removed) && predicate(slot)) {
+                removed = true;
+            }
+            else {
+                array->push_back(slot);
+            }
+        }
+
+        if (!removed) {
+            delete array;
+            return false;
+        }
+
+        if (array->empty()) {
+            delete array;
+            array = nullptr;
+        }
+
+        replace(array, freed);
+        return true;
+    }
+
     // clears all signal slots
     auto& operator=(void* ptr) {
         if (ptr == nullptr) {
-            slots_.clear();
+            std::unique_ptr<const Slots> freed;
+            cs::Lock lock(mutex_);
+            replace(nullptr, freed);
         }
 
         return *this;
     }
 
     std::size_t size() const noexcept {
-        return slots_.size();
-    }
+        cs::Lock lock(mutex_);
+        const Slots* array = slots_.load();
 
-    Slots& content() noexcept {
-        return slots_;
+        return array ? array->size() : 0;
     }
 
-    const Slots& content() const noexcept {
-        return slots_;
+    virtual void drop(void* object) override final {
+        remove([object](const Slot& slot) { return slot.object == ObjectPointer(object); }, true);
     }
 
-    virtual void drop(void* object) override final {
-        for (auto iterator = slots_.begin(); iterator != slots_.end();) {
-            if (iterator->first == ObjectPointer(object)) {
-                iterator = slots_.erase(iterator);
-            }
-            else {
-                ++iterator;
-            }
+    // publishes new slots array, called under mutex, previous one is freed out of it
+    // as slot destructors may change connections
+    void replace(const Slots* array, std::unique_ptr<const Slots>& freed) {
+        const Slots* previous = slots_.exchange(array);
+
+        if (previous && cshelper::Reclaimer::retire(previous)) {
+            freed.reset(previous);
         }
     }
 
     // all connected slots
-    Slots slots_;
+    std::atomic<const Slots*> slots_ = nullptr;
+
+    // serializes connection changes of this signal
+    mutable std::mutex mutex_;
 
     friend class Connector;
 
@@ -157,9 +575,9 @@ private:
 template <typename T>
 class Signal<std::function<T>> : public ISignal {
 public:
-    using Argument = std::function<T>;
+    using Argument = typename Signal<T>::Argument;
     using Signature = T;
-    using Slots = std::vector<std::pair<ObjectPointer, Argument>>;
+    using Slot = typename Signal<T>::Slot;
 
     ///
     /// @brief Generates signal.
@@ -184,18 +602,20 @@ public:
         return *this;
     }
 
-    ~Signal() {
-        (*this) = nullptr;
-    }
+    ~Signal() = default;
 
 private:
     // adds slot to signal
-    template <typename U>
-    auto& add(U&& s, ObjectPointer obj = nullptr) {
-        signal_.add(std::forward<U>(s), obj);
+    auto& add(Argument&& delegate, ObjectPointer obj = nullptr) {
+        signal_.add(std::move(delegate), obj);
         return *this;
     }
 
+    template <typename Predicate>
+    bool remove(Predicate predicate, bool all) {
+        return signal_.remove(std::move(predicate), all);
+    }
+
     // clears all slots
     auto& operator=(void* ptr) {
         signal_ = ptr;
@@ -206,14 +626,6 @@ private:
         return signal_.size();
     }
 
-    Slots& content() noexcept {
-        return signal_.content();
-    }
-
-    const Slots& content() const noexcept {
-        return signal_.content();
-    }
-
     virtual void drop(void* object) override final {
         signal_.drop(object);
     }
@@ -235,126 +647,20 @@ struct GetArguments<T (C::*)(Args...)> : std::integral_constant<unsigned, sizeof
 template <typename T, typename C, typename... Args>
 struct GetArguments<T (C::*)(Args...) const> : std::integral_constant<unsigned, sizeof...(Args)> {};
 
-// bindings
-template <int>
-class CheckArgs {
-public:
-    template <typename T, typename Slot>
-    void connect(const T& slotObj, Slot&& slot);
-};
-
-template <>
-class CheckArgs<0> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj);
-    }
-};
-
-template <>
-class CheckArgs<1> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1);
-    }
-};
-
-template <>
-class CheckArgs<2> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2);
-    }
-};
-
-template <>
-class CheckArgs<3> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-    }
-};
-
-template <>
-class CheckArgs<4> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4);
-    }
-};
-
-template <>
-class CheckArgs<5> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5);
-    }
-};
-
-template <>
-class CheckArgs<6> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
-                         std::placeholders::_6);
-    }
-};
-
-template <>
-class CheckArgs<7> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
-                         std::placeholders::_6, std::placeholders::_7);
-    }
-};
-
-template <>
-class CheckArgs<8> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
-                         std::placeholders::_6, std::placeholders::_7, std::placeholders::_8);
-    }
-};
-
-template <>
-class CheckArgs<9> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
-                         std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9);
-    }
-};
-
-template <>
-class CheckArgs<10> {
-public:
-    template <typename T, typename Slot>
-    auto connect(const T& slotObj, Slot&& slot) {
-        return std::bind(std::forward<Slot>(slot), slotObj, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
-                         std::placeholders::_6, std::placeholders::_7, std::placeholders::_8, std::placeholders::_9, std::placeholders::_10);
-    }
-};
-}  // namespace Args
+template <typename Object, typename Slot>
+using MethodSlotFor = MethodSlot<std::decay_t<Object>, std::decay_t<Slot>, GetArguments<std::decay_t<Slot>>::value>;
+}  // namespace cshelper
 
 ///
-/// Signal - slot connection entity
+/// Signal - slot connection entity.
+/// Every signal serializes its own connection changes, emission does not lock.
 ///
 class Connector {
     template <typename Object>
     static ObjectPointer checkConnection(const ISignal* signal, const Object& object, std::true_type) {
         IConnectable* connectable = static_cast<IConnectable*>(object);
+
+        cs::Lock lock(connectable->mutex_);
         connectable->signals_.push_back(const_cast<ISignal*>(signal));
 
         return ObjectPointer(connectable);
@@ -381,8 +687,7 @@ public:
     ///
     template <template <typename> typename Signal, typename T>
     static void connect(const Signal<T>* signal, typename Signal<T>::Argument slot) {
-        cs::Lock lock(mutex_);
-        const_cast<Signal<T>*>(signal)->add(slot);
+        const_cast<Signal<T>*>(signal)->add(std::move(slot));
     }
 
     ///
@@ -393,11 +698,10 @@ public:
     ///
     template <template <typename> typename Signal, typename T, typename Object, typename Slot>
     static void connect(const Signal<T>* signal, const Object& slotObj, Slot&& slot) {
-        constexpr int size = cshelper::GetArguments<Slot>();
+        using MethodSlot = cshelper::MethodSlotFor<Object, Slot>;
 
-        cs::Lock lock(mutex_);
         auto obj = cs::Connector::checkConnection(static_cast<const ISignal*>(signal), slotObj, std::is_base_of<IConnectable, std::remove_pointer_t<Object>>());
-        const_cast<Signal<T>*>(signal)->add(cshelper::CheckArgs<size>().connect(slotObj, std::forward<Slot>(slot)), obj);
+        const_cast<Signal<T>*>(signal)->add(MethodSlot{slotObj, std::forward<Slot>(slot)}, obj);
     }
 
     ///
@@ -417,8 +721,7 @@ public:
             }
         };
 
-        std::function<typename Signal<T>::Signature> func = closure;
-        cs::Connector::connect(lhs, std::move(func));
+        cs::Connector::connect(lhs, typename Signal<T>::Argument(closure));
     }
 
     ///
@@ -435,29 +738,12 @@ public:
             return false;
         }
 
-        constexpr int size = cshelper::GetArguments<Slot>();
-        std::function<T> binder = cshelper::CheckArgs<size>().connect(slotObj, std::forward<Slot>(slot));
-
-        cs::Lock lock(mutex_);
-        auto& content = const_cast<Signal<T>*>(signal)->content();
-        auto iterator = std::find_if(content.begin(), content.end(), [&](const auto& pair) {
-            auto& [object, function] = pair;
-
-            if (object) {
-                if (object == (slotObj)) {
-                    return function.target_type().hash_code() == binder.target_type().hash_code();
-                }
-            }
-
-            return false;
-        });
+        using MethodSlot = cshelper::MethodSlotFor<Object, Slot>;
 
-        if (iterator != content.end()) {
-            content.erase(iterator);
-            return true;
-        }
-
-        return false;
+        return const_cast<Signal<T>*>(signal)->remove([&](const auto& connection) {
+            auto target = connection.delegate.template target<MethodSlot>();
+            return target != nullptr && target->object == slotObj && target->method == slot;
+        }, false);
     }
 
     ///
@@ -467,24 +753,9 @@ public:
     ///
     template <template <typename> typename Signal, typename T>
     static bool disconnect(const Signal<T>* signal, typename Signal<T>::Argument slot) {
-        cs::Lock lock(mutex_);
-        auto& content = const_cast<Signal<T>*>(signal)->content();
-        auto iterator = std::find_if(content.begin(), content.end(), [&](const auto& pair) {
-            auto& [object, function] = pair;
-
-            if (!object) {
-                return function.target_type().hash_code() == slot.target_type().hash_code();
-            }
-
-            return false;
-        });
-
-        if (iterator != content.end()) {
-            content.erase(iterator);
-            return true;
-        }
-
-        return false;
+        return const_cast<Signal<T>*>(signal)->remove([&](const auto& connection) {
+            return !connection.object && connection.delegate.targetType() == slot.targetType();
+        }, false);
     }
 
     ///
@@ -493,11 +764,10 @@ public:
     ///
     template <template <typename> typename Signal, typename T>
     static bool disconnect(const Signal<T>* signal) {
-        cs::Lock lock(mutex_);
         auto signalPtr = const_cast<Signal<T>*>(signal);
         *(signalPtr) = nullptr;
 
-        return signalPtr->content().empty();
+        return signalPtr->size() == 0;
     }
 
     ///
@@ -505,7 +775,6 @@ public:
     ///
     template <typename Object, typename = std::enable_if_t<std::is_pointer_v<Object> && std::is_class_v<std::remove_pointer_t<Object>>>>
     static void disconnect(const ISignal* signal, const Object& object) {
-        cs::Lock lock(mutex_);
         const_cast<ISignal*>(signal)->drop(ObjectPointer(object));
     }
 
@@ -526,12 +795,8 @@ public:
     ///
     template <template <typename> typename Signal, typename T>
     static std::size_t callbacks(const Signal<T>* signal) {
-        cs::Lock lock(mutex_);
         return signal->size();
     }
-
-private:
-    inline static std::mutex mutex_;
 };
 
 // forward realization
@@ -8,3 +8,12 @@ size_t std::hash<cs::PublicKey>::operator()(const cs::PublicKey& key) const {
 
     return res;
 }
+
+size_t std::hash<cs::Signature>::operator()(const cs::Signature& signature) const {
+    static_assert(sizeof(size_t) < sizeof(cs::Signature));
+
+    size_t res;
+    std::copy(signature.data(), signature.data() + sizeof(res), reinterpret_cast<uint8_t*>(&res));
+
+    return res;
+}
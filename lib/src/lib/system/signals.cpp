@@ -0,0 +1,170 @@
+#include <lib/system/signals.hpp>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define CS_PRIVATE_EXPEDITED_MEMBARRIER
+#endif
+#endif
+
+namespace cs::cshelper {
+namespace {
+bool registerBarrier() {
+#if defined(_WIN32)
+    return true;
+#elif defined(CS_PRIVATE_EXPEDITED_MEMBARRIER)
+    // fails on kernels older than headers, emissions keep seq_cst store then
+    return syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+// full memory barrier on each running thread of process
+void barrier() {
+#if defined(_WIN32)
+    FlushProcessWriteBuffers();
+#elif defined(CS_PRIVATE_EXPEDITED_MEMBARRIER)
+    syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+#endif
+}
+}  // namespace
+
+// emission from destructor of a later thread local object takes a new record
+struct Reclaimer::Owner {
+    Record* record = nullptr;
+
+    ~Owner() {
+        if (record) {
+            record->used.store(false, std::memory_order_release);
+            local_ = nullptr;
+        }
+    }
+};
+
+// Emission stores epoch, then reads array. Connection change replaces array, then scans epochs.
+// Either the scan sees the epoch or the emission sees the new array: both sides are ordered by
+// seq_cst operations or, if the barrier is registered, by a barrier started after the replace.
+bool Reclaimer::retire(const void* object, Destroy destroy) {
+    const uint64_t epoch = epoch_.fetch_add(1);
+    synchronize(epoch);
+
+    if (epoch < oldestEpoch()) {
+        return true;
+    }
+
+    auto retired = new Retired{epoch, object, destroy, nullptr};
+    defer(retired, retired);
+
+    return false;
+}
+
+void Reclaimer::collect() {
+    Retired* retired = deferred_.exchange(nullptr, std::memory_order_acquire);
+
+    if (!retired) {
+        return;
+    }
+
+    // epochs of emissions which could read deferred objects were synchronized by retire()
+    const uint64_t oldest = oldestEpoch();
+    Retired* first = nullptr;
+    Retired* last = nullptr;
+
+    // no lock is held, slot destructors may change connections
+    while (retired) {
+        Retired* next = retired->next;
+
+        if (retired->epoch < oldest) {
+            retired->destroy(retired->object);
+            delete retired;
+        }
+        else {
+            retired->next = first;
+            first = retired;
+            last = last ? last : retired;
+        }
+
+        retired = next;
+    }
+
+    if (first) {
+        defer(first, last);
+    }
+}
+
+// Epoch read before a barrier is greater than the epoch of any object retired before the read,
+// so concurrent connection changes share one barrier.
+void Reclaimer::synchronize(uint64_t epoch) {
+    if (!isAsymmetric() || barrierEpoch_.load(std::memory_order_acquire) > epoch) {
+        return;
+    }
+
+    const uint64_t start = epoch_.load();
+    barrier();
+
+    uint64_t current = barrierEpoch_.load(std::memory_order_relaxed);
+
+    while (current < start && !barrierEpoch_.compare_exchange_weak(current, start, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Reclaimer::oldestEpoch() {
+    uint64_t oldest = kQuiescent;
+
+    for (Record* record = head_.load(std::memory_order_acquire); record; record = record->next) {
+        oldest = std::min(oldest, record->epoch.load());
+    }
+
+    return oldest;
+}
+
+bool Reclaimer::isAsymmetric() {
+    // collector checks it before each scan, so it issues barriers once any emission may use plain store
+    static const bool registered = [] {
+        const bool result = registerBarrier();
+        asymmetric_.store(result, std::memory_order_release);
+        return result;
+    }();
+
+    return registered;
+}
+
+void Reclaimer::defer(Retired* first, Retired* last) {
+    last->next = deferred_.load(std::memory_order_relaxed);
+
+    while (!deferred_.compare_exchange_weak(last->next, first, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+Reclaimer::Record* Reclaimer::acquire() {
+    thread_local Owner owner;
+    Record* result = nullptr;
+
+    isAsymmetric();
+
+    for (Record* record = head_.load(std::memory_order_acquire); record && !result; record = record->next) {
+        bool used = false;
+
+        if (!record->used.load(std::memory_order_relaxed) && record->used.compare_exchange_strong(used, true, std::memory_order_acquire)) {
+            result = record;
+        }
+    }
+
+    if (!result) {
+        result = new Record();
+        result->next = head_.load(std::memory_order_relaxed);
+
+        while (!head_.compare_exchange_weak(result->next, result, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    owner.record = result;
+    return result;
+}
+}  // namespace cs::cshelper
@@ -0,0 +1,60 @@
+#ifndef DUPLICATE_FILTER_HPP
+#define DUPLICATE_FILTER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Bloom filter of two generations over message keys: the current one takes new keys,
+// the previous one still answers for them after rotation. Transport rotates it every round,
+// so a key is remembered for one to two rounds. The filter is not thread safe.
+class DuplicateFilter {
+public:
+    constexpr static size_t kDefaultCapacity = 8192;
+    constexpr static double kDefaultFalsePositiveRate = 0.001;
+
+    DuplicateFilter();
+
+    // capacity is the count of keys a generation takes before it rotates by itself,
+    // zero false positive rate disables the filter
+    DuplicateFilter(size_t capacity, double falsePositiveRate);
+
+    static uint64_t getKey(const uint8_t* data, size_t size);
+
+    // returns true if the key is met, otherwise remembers it
+    bool testAndAdd(uint64_t key);
+
+    // forgets the previous generation, the current one becomes previous
+    void rotate();
+
+    bool isEnabled() const {
+        return hashesCount_ != 0;
+    }
+
+    size_t bitsCount() const {
+        return bitsCount_;
+    }
+
+    size_t hashesCount() const {
+        return hashesCount_;
+    }
+
+private:
+    struct Generation {
+        std::vector<uint64_t> bits;
+        size_t count = 0;
+    };
+
+    bool contains(const Generation&, uint64_t key) const;
+    void add(Generation&, uint64_t key);
+
+    size_t capacity_;
+    size_t bitsCount_ = 0;
+    size_t hashesCount_ = 0;
+
+    std::array<Generation, 2> generations_;
+    size_t current_ = 0;
+};
+
+#endif // DUPLICATE_FILTER_HPP
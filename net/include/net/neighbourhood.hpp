@@ -6,9 +6,12 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <set>
+#include <vector>
 
 #include <networkcommands.hpp>
 #include <packet.hpp>
+#include <packetcompressor.hpp>
+#include <peerquality.hpp>
 
 #include <lib/system/signals.hpp>
 
@@ -25,6 +28,10 @@ public:
 
     constexpr static std::chrono::seconds kPingInterval{2};
 
+    // candidates asked at once to fill free neighbour slots in addition to slots count,
+    // the next ones are asked on each ping while slots are free
+    constexpr static size_t kSpareCandidates = 2;
+
     Neighbourhood(Transport*, Node*);
 
     void setPermanentNeighbours(const std::set<cs::PublicKey>&);
@@ -38,6 +45,15 @@ public:
     void forEachNeighbour(NeighboursCallback);
     uint32_t getNeighboursCount() const;
     bool contains(const cs::PublicKey& neighbour) const;
+
+    // the newest pack method announced by neighbour, None if it can not unpack packets
+    PacketCompressor::Method getPackMethod(const cs::PublicKey& neighbour) const;
+    bool canSplitFrames(const cs::PublicKey& neighbour) const;
+
+    PeerQuality getQuality(const cs::PublicKey& peer) const;
+
+    // neighbours ordered by quality, the best first
+    std::vector<cs::PublicKey> getBestNeighbours(size_t count) const;
     void add(const std::set<cs::PublicKey>&);
 
 public signals:
@@ -52,6 +68,8 @@ private:
         uint64_t uuid = 0;
         cs::Sequence lastSeq = 0;
         cs::RoundNumber roundNumber = 0;
+        cs::Byte packMethod = PacketCompressor::Method::None;
+        bool splitsFrames = false;
         bool permanent = false;
     };
 
@@ -74,6 +92,10 @@ private:
     void tryToAddNew(const cs::PublicKey&, const PeerInfo&);
     bool remove(const cs::PublicKey&);
 
+    void onRequestSent(const cs::PublicKey&);
+    void onReplyReceived(const cs::PublicKey&);
+    void sortByQuality(std::vector<cs::PublicKey>&) const;
+
     Transport* transport_;
     Node* node_;
 
@@ -85,5 +107,9 @@ private:
 
     mutable std::mutex permNeighbourMux_;
     std::unordered_set<cs::PublicKey> permanentNeighbours_;
+
+    // of neighbours and candidates, taken after neighbourMutex_ if both are needed
+    mutable std::mutex qualityMux_;
+    std::unordered_map<cs::PublicKey, PeerQuality> qualities_;
 };
 #endif  // NEIGHBOURHOOD_HPP
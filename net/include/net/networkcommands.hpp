@@ -8,7 +8,8 @@ enum class NetworkCommand : uint8_t {
     VersionRequest,
     VersionReply,
     Ping,
-    Pong
+    Pong,
+    Frame // coalesced node messages, see PacketCoalescer
 };
 
 const char* networkCommandToString(NetworkCommand command);
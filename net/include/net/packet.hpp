@@ -18,7 +18,8 @@ enum BaseFlags : uint8_t {
     Clear = 0,
     NetworkMsg = 1,
     Compressed = 1 << 1,
-    Signed = 1 << 2
+    Signed = 1 << 2,
+    Packed = 1 << 3 // payload is compressed by transport, see PacketCompressor
 };
 
 enum MsgTypes : uint8_t {
@@ -94,6 +95,10 @@ public:
         return checkFlag(BaseFlags::Signed);
     }
 
+    bool isPacked() const {
+        return checkFlag(BaseFlags::Packed);
+    }
+
     MsgTypes getType() const {
         return getWithOffset<MsgTypes>(Offsets::MsgTypes);
     }
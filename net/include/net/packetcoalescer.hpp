@@ -0,0 +1,87 @@
+#ifndef PACKET_COALESCER_HPP
+#define PACKET_COALESCER_HPP
+
+#include <chrono>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <lib/system/common.hpp>
+
+#include "packet.hpp"
+
+// Batches small node messages bound for the same receiver into one frame, so a round does not pay
+// header and syscall cost for each stage hash or request. Messages wait for others not longer than
+// latency of settings, a frame is a network packet of Frame command followed by sized messages.
+// Not thread safe, Transport guards it and sends taken frames in order.
+class PacketCoalescer {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Frames = std::vector<std::pair<cs::PublicKey, cs::Bytes>>;
+
+    struct Settings {
+        Clock::duration latency = std::chrono::milliseconds(1);
+        size_t maxMessageSize = 1024;
+        size_t maxFrameSize = 8 * 1024;
+    };
+
+    struct Metrics {
+        uint64_t frames = 0;
+        uint64_t framedMessages = 0;
+        uint64_t singleMessages = 0; // waited for others, but sent alone
+        uint64_t latencyUs = 0; // added to all coalesced messages
+        uint64_t maxLatencyUs = 0;
+
+        double messagesPerFrame() const {
+            return frames ? static_cast<double>(framedMessages) / static_cast<double>(frames) : 0.0;
+        }
+    };
+
+    constexpr static size_t kFrameHeaderSize = static_cast<size_t>(Offsets::NetworkHeaderLength);
+    constexpr static size_t kMessageHeaderSize = sizeof(uint32_t);
+
+    static bool isFrame(const Packet&);
+
+    // returns false if frame is malformed
+    static bool split(const Packet& frame, std::vector<Packet>& packets);
+
+    PacketCoalescer();
+    explicit PacketCoalescer(const Settings& settings);
+
+    bool isCoalescable(const Packet&) const;
+
+    // appends message to frame of receiver, moves frame to ready if it is full,
+    // returns true if message starts a new frame
+    bool add(const cs::PublicKey& receiver, const Packet&, Clock::time_point now, Frames& ready);
+
+    // moves frame of receiver to ready, so the next message of receiver is sent after it,
+    // taken frames are erased, so only receivers with pending messages hold a frame buffer
+    void take(const cs::PublicKey& receiver, Clock::time_point now, Frames& ready);
+    void takeExpired(Clock::time_point now, Frames& ready);
+    void takeAll(Clock::time_point now, Frames& ready);
+
+    std::optional<Clock::time_point> nextDeadline() const;
+    bool empty() const;
+
+    // count of receivers with pending messages
+    size_t receivers() const;
+
+    const Metrics& getMetrics() const;
+
+private:
+    struct Frame {
+        cs::Bytes data;
+        size_t messages = 0;
+        Clock::time_point start;
+        Clock::duration delays{}; // sum of message delays from start
+    };
+
+    void take(const cs::PublicKey& receiver, Frame&, Clock::time_point now, Frames& ready);
+
+    Settings settings_;
+    std::unordered_map<cs::PublicKey, Frame> frames_;
+    Metrics metrics_;
+};
+
+#endif // PACKET_COALESCER_HPP
@@ -0,0 +1,72 @@
+#ifndef PACKET_COMPRESSOR_HPP
+#define PACKET_COMPRESSOR_HPP
+
+#include <array>
+#include <atomic>
+
+#include <lib/system/common.hpp>
+
+#include "packet.hpp"
+
+// Compresses payloads of node packets flagged as Compressed by LZ4. Peers announce the newest
+// pack method they can unpack in version reply, packets to peers which announce none are sent as is.
+// Packed payload starts with method and original payload size.
+class PacketCompressor {
+public:
+    enum Method : cs::Byte {
+        None,
+        Lz4
+    };
+
+    constexpr static Method kNewestMethod = Method::Lz4;
+
+    struct Metrics {
+        uint64_t packed = 0;
+        uint64_t bytes = 0;
+        uint64_t packedBytes = 0;
+        uint64_t packTimeNs = 0;
+        uint64_t unpacked = 0;
+        uint64_t unpackTimeNs = 0;
+
+        double ratio() const {
+            return packedBytes ? static_cast<double>(bytes) / static_cast<double>(packedBytes) : 1.0;
+        }
+    };
+
+    constexpr static size_t kHeaderSize = sizeof(Method) + sizeof(uint32_t);
+    constexpr static size_t kMinPayloadSize = 64;
+    constexpr static size_t kMaxPayloadSize = 1ul << 26; // 67_108_864 bytes
+    // LZ4 can not compress better, a peer claiming larger original size lies
+    constexpr static size_t kMaxRatio = 255;
+
+    // block replies are compressed by node
+    static bool isPackable(MsgTypes);
+
+    // size of packet after unpack, read from packed payload header
+    static size_t getUnpackedSize(const Packet&);
+
+    // method for peer which announced the newest method it unpacks
+    static Method getMethod(Method peerMethod);
+
+    // returns false if packet is left as is
+    bool pack(Packet&, Method) const;
+    bool unpack(Packet&) const;
+
+    Metrics getMetrics(MsgTypes) const;
+
+private:
+    struct MetricsData {
+        std::atomic<uint64_t> packed = 0;
+        std::atomic<uint64_t> bytes = 0;
+        std::atomic<uint64_t> packedBytes = 0;
+        std::atomic<uint64_t> packTimeNs = 0;
+        std::atomic<uint64_t> unpacked = 0;
+        std::atomic<uint64_t> unpackTimeNs = 0;
+    };
+
+    constexpr static size_t kMsgTypesCount = 256;
+
+    mutable std::array<MetricsData, kMsgTypesCount> metrics_;
+};
+
+#endif // PACKET_COMPRESSOR_HPP
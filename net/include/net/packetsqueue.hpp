@@ -1,20 +1,44 @@
 #ifndef PACKETS_QUEUE_HPP
 #define PACKETS_QUEUE_HPP
 
-#include <list>
+#include <atomic>
+#include <deque>
+#include <unordered_map>
 #include <utility>
 
 #include <lib/system/common.hpp>
+#include <lib/system/queues.hpp>
 
 #include "packet.hpp"
 
+// Many network threads push packets, one worker pops them. Each priority has its own
+// preallocated ring. A packet that does not fit is dropped on push, queued packets are never evicted:
+// second priority packets may take only half of bytes limit, so first priority ones always have room.
+// The worker moves packets from rings to queues of senders, senders of a priority take turns
+// by deficit round robin, so one sender can not hold the worker while others wait.
 class PacketsQueue {
 public:
     using SenderAndPacket = std::pair<cs::PublicKey, Packet>;
 
+    constexpr static size_t kDefaultCapacity = 1ul << 14; // 16_384 packets of each priority
+    constexpr static size_t kMaxBytesToHandle = 1ul << 29; // 536_870_912 bytes
+    constexpr static size_t kMaxSecondPriorityBytes = kMaxBytesToHandle / 2;
+
+    // bytes a sender may take from the worker per turn
+    constexpr static size_t kQuantum = 1ul << 16;
+
+    explicit PacketsQueue(size_t capacity = kDefaultCapacity);
+
+    // reader only
     bool empty() const;
-    SenderAndPacket pop();
-    void push(const cs::PublicKey&, Packet&&);
+    bool pop(SenderAndPacket&);
+
+    // returns false if packet is dropped
+    bool push(const cs::PublicKey&, Packet&&);
+
+    size_t size() const;
+    size_t bytes() const;
+    size_t dropped() const;
 
 private:
     enum class Priority {
@@ -22,19 +46,39 @@ private:
         kSecond
     };
 
+    struct SenderPackets {
+        std::deque<Packet> packets;
+        size_t deficit = 0;
+    };
+
+    // reader only
+    struct Scheduler {
+        std::unordered_map<cs::PublicKey, SenderPackets> senders;
+        std::deque<cs::PublicKey> turns;
+        bool granted = false; // sender of the first turn has got its quantum
+
+        bool empty() const {
+            return turns.empty();
+        }
+
+        void push(SenderAndPacket&&);
+        bool pop(SenderAndPacket&);
+    };
+
     Priority getPriority(MsgTypes type) const;
-    size_t numPackets() const;
-    size_t numBytes() const;
-    bool shrink();
+    static bool reserve(std::atomic<size_t>& counter, size_t amount, size_t limit);
 
-    constexpr static size_t kMaxPacketsToHandle = 1ul << 17; // 131_072
-    constexpr static size_t kMaxBytesToHandle = 1ul << 29; // 536_870_912 bytes
+    MPSCQueue<SenderAndPacket> firstPriorityQ_;
+    MPSCQueue<SenderAndPacket> secondPriorityQ_;
+
+    Scheduler firstPriorityScheduler_;
+    Scheduler secondPriorityScheduler_;
 
-    size_t firstQBytes_ = 0;
-    size_t secondQBytes_ = 0;
+    const size_t maxSize_;
 
-    std::list<SenderAndPacket> firstPriorityQ_;
-    std::list<SenderAndPacket> secondPriorityQ_;
+    std::atomic<size_t> size_ = 0;
+    std::atomic<size_t> bytes_ = 0;
+    std::atomic<size_t> dropped_ = 0;
 };
 
 #endif // PACKETS_QUEUE_HPP
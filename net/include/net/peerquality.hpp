@@ -0,0 +1,56 @@
+#ifndef PEER_QUALITY_HPP
+#define PEER_QUALITY_HPP
+
+#include <chrono>
+#include <optional>
+
+// Round trip time, jitter and delivery rate of a peer measured by request and reply pairs:
+// ping and pong, version request and reply. One request is awaited at a time, a request left
+// without reply until the next one is lost. Smoothing of round trip time follows RFC 6298.
+class PeerQuality {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Duration = Clock::duration;
+
+    void onRequest(Clock::time_point now);
+
+    // returns false if there is no request to answer
+    bool onReply(Clock::time_point now);
+
+    bool isMeasured() const {
+        return measured_;
+    }
+
+    // request is sent and not answered yet
+    bool isAwaiting() const {
+        return requestSent_.has_value();
+    }
+
+    Duration rtt() const {
+        return rtt_;
+    }
+
+    Duration jitter() const {
+        return jitter_;
+    }
+
+    double deliveryRate() const {
+        return deliveryRate_;
+    }
+
+    // expected time to get a reply, lower is better, unmeasured peers are the worst
+    Duration score() const;
+
+    // the better peer goes first, unmeasured peers are ordered by delivery rate
+    static bool isBetter(const PeerQuality& lhs, const PeerQuality& rhs);
+
+private:
+    std::optional<Clock::time_point> requestSent_;
+
+    Duration rtt_{};
+    Duration jitter_{};
+    double deliveryRate_ = 1.0;
+    bool measured_ = false;
+};
+
+#endif // PEER_QUALITY_HPP
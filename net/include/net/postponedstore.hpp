@@ -0,0 +1,66 @@
+#ifndef POSTPONED_STORE_HPP
+#define POSTPONED_STORE_HPP
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <lib/system/common.hpp>
+
+#include "packet.hpp"
+
+// Packets of future rounds kept until the node gets to their round. Packets are moved in
+// and moved out, their buffers are never copied. Total bytes and bytes of each sender are limited:
+// a packet over sender quota is rejected, a packet over total budget evicts packets of
+// the furthest rounds after its own one, or is rejected if there are none.
+// The store is not thread safe, transport guards it by a mutex.
+class PostponedStore {
+public:
+    constexpr static size_t kMaxBytes = 64ul * 1024 * 1024;
+    constexpr static size_t kMaxSenderBytes = 8ul * 1024 * 1024;
+
+    struct PostponedPack {
+        cs::PublicKey sender;
+        Packet pack;
+    };
+
+    using Packs = std::vector<PostponedPack>;
+
+    struct Metrics {
+        size_t packets = 0;
+        size_t bytes = 0;
+        size_t rounds = 0;
+        uint64_t evicted = 0;
+        uint64_t rejected = 0;
+    };
+
+    PostponedStore();
+    PostponedStore(size_t maxBytes, size_t maxSenderBytes);
+
+    // returns false if packet is rejected
+    bool add(const cs::PublicKey& sender, cs::RoundNumber, Packet&&);
+
+    // moves out packets of round, packets of earlier rounds are forgotten
+    Packs take(cs::RoundNumber);
+
+    Metrics getMetrics() const;
+
+private:
+    void release(const PostponedPack&);
+
+    // removes the last packet of the furthest round after round, returns false if there are none
+    bool evictAfter(cs::RoundNumber);
+
+    std::map<cs::RoundNumber, Packs> rounds_;
+    std::unordered_map<cs::PublicKey, size_t> senderBytes_;
+
+    size_t maxBytes_;
+    size_t maxSenderBytes_;
+
+    size_t packets_ = 0;
+    size_t bytes_ = 0;
+    uint64_t evicted_ = 0;
+    uint64_t rejected_ = 0;
+};
+
+#endif // POSTPONED_STORE_HPP
@@ -0,0 +1,68 @@
+#ifndef SENDER_LIMITER_HPP
+#define SENDER_LIMITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <lib/system/common.hpp>
+
+// Token bucket of each sender for one class of messages. A bucket refills by rate up to burst,
+// a packet takes its size and a fixed cost, so floods of small packets are limited too.
+// A packet larger than burst passes a full bucket and leaves it in debt.
+// Network threads take tokens concurrently, buckets are guarded by the lock.
+class SenderLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // bytes a packet costs above its size
+    constexpr static size_t kPacketCost = 1024;
+
+    // refilled buckets of senders never throttled are dropped first,
+    // the others are dropped only when there are more buckets than this
+    constexpr static size_t kMaxBuckets = 4096;
+
+    struct Counters {
+        uint64_t throttled = 0;
+        uint64_t throttledBytes = 0;
+    };
+
+    using SenderCounters = std::pair<cs::PublicKey, Counters>;
+
+    SenderLimiter();
+    SenderLimiter(double rate, size_t burst);
+
+    // rate is in bytes per second
+    void setLimits(double rate, size_t burst);
+
+    // returns false if sender has not enough tokens, the packet should be dropped then
+    bool take(const cs::PublicKey& sender, size_t bytes, Clock::time_point now);
+
+    // forgets buckets refilled up to burst
+    void prune(Clock::time_point now);
+
+    uint64_t throttled() const;
+    std::vector<SenderCounters> getThrottledSenders() const;
+
+private:
+    struct Bucket {
+        double tokens = 0;
+        Clock::time_point updated;
+        Counters counters;
+    };
+
+    void refill(Bucket&, Clock::time_point now) const;
+
+    mutable std::mutex mux_;
+    std::unordered_map<cs::PublicKey, Bucket> buckets_;
+
+    double rate_;
+    double burst_;
+
+    std::atomic<uint64_t> throttled_ = 0;
+};
+
+#endif // SENDER_LIMITER_HPP
@@ -0,0 +1,72 @@
+#ifndef TRAFFIC_STATS_HPP
+#define TRAFFIC_STATS_HPP
+
+#include <array>
+#include <atomic>
+
+#include <lib/system/common.hpp>
+
+#include "packet.hpp"
+
+// Counts node messages by type: traffic in and out, drops, handling time.
+// Network thread, lane workers and senders update counters concurrently without locks.
+class TrafficStats {
+public:
+    // handling time by decades: < 10 us, < 100 us, ..., < 1 s, >= 1 s
+    constexpr static size_t kHistogramSize = 7;
+
+    struct Counters {
+        uint64_t packetsIn = 0;
+        uint64_t bytesIn = 0; // as received, packed payloads are counted by packed size
+        uint64_t unpackedBytesIn = 0;
+        uint64_t packetsOut = 0;
+        uint64_t bytesOut = 0;
+        uint64_t unpackedBytesOut = 0;
+        uint64_t dropped = 0; // by full lane queue
+        uint64_t duplicates = 0; // dropped by duplicate filter
+        uint64_t throttled = 0; // dropped by token bucket of sender
+        uint64_t rejected = 0; // by packet validator
+        uint64_t handled = 0;
+        uint64_t handlingTimeUs = 0;
+        std::array<uint64_t, kHistogramSize> handlingTimeHistogram{};
+    };
+
+    static size_t getHistogramBucket(uint64_t durationUs);
+    static const char* getHistogramBucketName(size_t bucket);
+
+    void onReceived(MsgTypes, size_t bytes, size_t unpackedBytes);
+    void onSent(MsgTypes, size_t bytes, size_t unpackedBytes, size_t receiversCount);
+    void onDropped(MsgTypes);
+    void onDuplicate(MsgTypes);
+    void onThrottled(MsgTypes);
+    void onRejected(MsgTypes);
+    void onHandled(MsgTypes, uint64_t durationUs);
+
+    Counters get(MsgTypes) const;
+
+    // logs a line for each type met in traffic
+    void print() const;
+
+private:
+    struct AtomicCounters {
+        std::atomic<uint64_t> packetsIn = 0;
+        std::atomic<uint64_t> bytesIn = 0;
+        std::atomic<uint64_t> unpackedBytesIn = 0;
+        std::atomic<uint64_t> packetsOut = 0;
+        std::atomic<uint64_t> bytesOut = 0;
+        std::atomic<uint64_t> unpackedBytesOut = 0;
+        std::atomic<uint64_t> dropped = 0;
+        std::atomic<uint64_t> duplicates = 0;
+        std::atomic<uint64_t> throttled = 0;
+        std::atomic<uint64_t> rejected = 0;
+        std::atomic<uint64_t> handled = 0;
+        std::atomic<uint64_t> handlingTimeUs = 0;
+        std::array<std::atomic<uint64_t>, kHistogramSize> handlingTimeHistogram{};
+    };
+
+    constexpr static size_t kMsgTypesCount = 256;
+
+    std::array<AtomicCounters, kMsgTypesCount> counters_;
+};
+
+#endif // TRAFFIC_STATS_HPP
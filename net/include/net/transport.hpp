@@ -2,7 +2,10 @@
 #ifndef TRANSPORT_HPP
 #define TRANSPORT_HPP
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <csignal>
 #include <list>
 #include <map>
@@ -20,15 +23,22 @@
 
 #include <p2p_network.h>
 
+#include "duplicatefilter.hpp"
 #include "neighbourhood.hpp"
 #include "packet.hpp"
+#include "packetcoalescer.hpp"
+#include "packetcompressor.hpp"
 #include "packetsqueue.hpp"
+#include "postponedstore.hpp"
+#include "senderlimiter.hpp"
+#include "trafficstats.hpp"
 
 inline volatile std::sig_atomic_t gSignalStatus = 0;
 
 using PingSignal = cs::Signal<void(cs::Sequence, const cs::PublicKey&)>;
 using NeighbourAddedSignal = cs::Signal<void(const cs::PublicKey&, cs::Sequence, cs::RoundNumber)>;
 using NeighbourRemovedSignal = cs::Signal<void(const cs::PublicKey&)>;
+using NeighbourRttSignal = cs::Signal<void(const cs::PublicKey&, PeerQuality::Duration)>;
 
 class Node;
 
@@ -40,19 +50,59 @@ public:
     using AddressAndPort = std::pair<std::string, uint16_t>;
     using BanList = std::vector<AddressAndPort>;
 
+    // inbound node messages are dispatched by lanes, each lane has its own queue and worker,
+    // lanes are split by PacketsQueue priority, messages of a sender are handled in arrival order
+    // within a lane only, the ones on different lanes may be reordered,
+    // each sender has a token bucket in each lane
+    enum class Lane : size_t {
+        Consensus,
+        Transactions,
+        Sync,
+        Misc,
+        Count
+    };
+
+    struct LaneMetrics {
+        size_t depth = 0;
+        size_t bytes = 0;
+        size_t dropped = 0;
+        uint64_t throttled = 0;
+        uint64_t handled = 0;
+        uint64_t handlingTimeUs = 0;
+        uint64_t maxHandlingTimeUs = 0;
+    };
+
+    // receivers of multicast share one serialized packet, host takes own copy of it
+    struct SendMetrics {
+        uint64_t multicasts = 0;
+        uint64_t copies = 0;
+        uint64_t bytesCopied = 0;
+    };
+
+    // transaction packets dropped by duplicate filter, round is the last finished one
+    struct DuplicateMetrics {
+        uint64_t dropped = 0;
+        cs::RoundNumber round = 0;
+        uint64_t droppedInRound = 0;
+    };
+
+    static Lane getLane(MsgTypes);
+    static const char* getLaneName(Lane);
+
     explicit Transport(Node* node);
     ~Transport();
 
     void run();
     bool isGood() const { return good_; }
 
-    void processNodeMessage(const cs::PublicKey&, const Packet&);
+    void processNodeMessage(const cs::PublicKey&, Packet&&);
     void processPostponed(const cs::RoundNumber); // @TODO move to Node
 
     void sendDirect(Packet&&, const cs::PublicKey&);
     void sendMulticast(Packet&&, const std::vector<cs::PublicKey>&);
     void sendBroadcast(Packet&&);
     void sendBroadcastIfNoConnection(Packet&&, const cs::PublicKey&);
+    void sendBroadcastIfNoConnection(Packet&&, const std::vector<cs::PublicKey>&);
 
     void ban(const cs::PublicKey&);
     void revertBan(const cs::PublicKey&);
@@ -67,8 +117,21 @@ public:
     bool hasNeighbour(const cs::PublicKey&) const;
     void addToNeighbours(const std::set<cs::PublicKey>&);
 
+    // neighbours ordered by round trip time, jitter and delivery rate
+    std::vector<cs::PublicKey> getBestNeighbours(size_t count) const;
+    PeerQuality getPeerQuality(const cs::PublicKey&) const;
+
     void getKnownPeers(std::vector<cs::PeerData>&);
 
+    LaneMetrics getLaneMetrics(Lane) const;
+    std::vector<SenderLimiter::SenderCounters> getThrottledSenders(Lane) const;
+    SendMetrics getSendMetrics() const;
+    PacketCompressor::Metrics getCompressionMetrics(MsgTypes) const;
+    PacketCoalescer::Metrics getCoalescingMetrics() const;
+    TrafficStats::Counters getTrafficStats(MsgTypes) const;
+    PostponedStore::Metrics getPostponedMetrics() const;
+    DuplicateMetrics getDuplicateMetrics() const;
+
     // from neigbours
     // @param added - true if new neighbour adder, false if removed
     void onNeighboursChanged(const cs::PublicKey&, cs::Sequence lastSeq,
@@ -81,6 +144,7 @@ public signals:
     cs::Action mainThreadIterated;
     NeighbourAddedSignal neighbourAdded;
     NeighbourRemovedSignal neighbourRemoved;
+    NeighbourRttSignal neighbourRttUpdated;
 
 protected:
     // HostEventHandler
@@ -91,32 +155,97 @@ protected:
 private:
 // Postpone logic - beg
 // @TODO move to Node
-    void postponePacket(const cs::PublicKey& sender, const cs::RoundNumber, const Packet&);
+    void postponePacket(const cs::PublicKey& sender, const cs::RoundNumber, Packet&&);
 
-    struct PostponedPack {
-        cs::PublicKey sender;
-        Packet pack;
-    };
-    std::map<cs::RoundNumber, std::vector<PostponedPack>> postponed_;
+    // packets are added and taken by node handlers, metrics are read by transport thread
+    mutable std::mutex postponedMux_;
+    PostponedStore postponed_;
 // Postpone logic - end
 
+    bool validate(const Packet&);
+    void receivePacket(const cs::PublicKey& sender, Packet&&);
     void dispatchNodeMessage(const cs::PublicKey& sender, const MsgTypes,
                              const cs::RoundNumber, const uint8_t* data, size_t);
-    void processorRoutine();
+    struct LaneData {
+        std::condition_variable packetsReceived;
+        std::mutex mux;
+        PacketsQueue queue;
+        SenderLimiter limiter;
+        std::thread worker;
+
+        std::atomic<uint64_t> handled = 0;
+        std::atomic<uint64_t> handlingTimeUs = 0;
+        std::atomic<uint64_t> maxHandlingTimeUs = 0;
+    };
+
+    constexpr static size_t kLanesCount = static_cast<size_t>(Lane::Count);
+
+    void laneRoutine(Lane);
+    bool isDuplicate(const Packet&);
+    void handleLanePacket(Lane, PacketsQueue::SenderAndPacket&);
+
+    // block requests are served without dispatch, block replies are decoded and checked
+    // before it and only stored under it, returns time spent in node handlers
+    std::chrono::steady_clock::duration handleSyncPacket(const cs::PublicKey& sender, Packet&&);
+
+    // node handlers are not thread safe, lanes take turns to run them,
+    // the consensus lane waits for the running handler only
+    void beginDispatch(Lane);
+    void endDispatch();
+
     void process();
+
+    cs::Bytes copyData(const Packet&);
+    PacketCompressor::Method getPackMethod(const Packet&, const cs::PublicKey& receiver) const;
+
+    // sends copy of packet if copy is true, otherwise moves packet data to host
+    void sendPacket(Packet&, const cs::PublicKey& receiver, bool copy);
+    void sendFrames();
+    void sendAllFrames();
+    void coalescerRoutine();
     void checkNeighboursChange();
+    void printTrafficStats();
+
+    // lanes, compression, coalescing, sending and postponed packets, printed with traffic stats
+    void printMetrics() const;
 
     bool good_ = false;
     net::Config config_;
 
     Node* node_;
 
-    std::condition_variable newPacketsReceived_;
-    std::mutex inboxMux_;
-    PacketsQueue inboxQueue_;
+    std::array<LaneData, kLanesCount> lanes_;
+
+    std::condition_variable dispatchCondition_;
+    std::mutex dispatchMux_;
+    bool dispatching_ = false;
+    size_t consensusWaiting_ = 0;
+
+    std::atomic<uint64_t> multicasts_ = 0;
+    std::atomic<uint64_t> copies_ = 0;
+    std::atomic<uint64_t> bytesCopied_ = 0;
+
+    PacketCompressor compressor_;
+    TrafficStats trafficStats_;
+    std::chrono::steady_clock::time_point trafficStatsPrinted_ = std::chrono::steady_clock::now();
+
+    // only the transactions lane worker uses the filter, it rotates on round change
+    DuplicateFilter duplicateFilter_;
+    cs::RoundNumber duplicateFilterRound_ = 0;
+    uint64_t duplicatesInRound_ = 0;
+
+    std::atomic<uint64_t> duplicatesDropped_ = 0;
+    std::atomic<cs::RoundNumber> lastDuplicatesRound_ = 0;
+    std::atomic<uint64_t> lastRoundDuplicates_ = 0;
+
+    // frames are sent under the lock, so messages of a receiver keep their order
+    mutable std::mutex coalescerMux_;
+    std::condition_variable coalescerCondition_;
+    PacketCoalescer coalescer_;
+    PacketCoalescer::Frames readyFrames_;
+    std::thread coalescerWorker_;
 
     Neighbourhood neighbourhood_;
-    std::thread processorThread_;
 
     struct NeighbourData {
         const cs::PublicKey key;
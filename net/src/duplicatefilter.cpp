@@ -0,0 +1,104 @@
+#include "duplicatefilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string_view>
+
+namespace {
+constexpr size_t kWordBits = 64;
+constexpr size_t kMaxHashesCount = 16;
+
+// Kirsch-Mitzenmacher: i-th bit index is h1 + i * h2
+struct Probe {
+    uint64_t h1;
+    uint64_t h2;
+
+    explicit Probe(uint64_t key)
+    : h1(key)
+    , h2((key >> 32 | key << 32) * 0x9e3779b97f4a7c15ull | 1) {
+    }
+
+    size_t index(size_t i, size_t bitsCount) const {
+        return static_cast<size_t>((h1 + i * h2) % bitsCount);
+    }
+};
+}  // namespace
+
+DuplicateFilter::DuplicateFilter()
+: DuplicateFilter(kDefaultCapacity, kDefaultFalsePositiveRate) {
+}
+
+DuplicateFilter::DuplicateFilter(size_t capacity, double falsePositiveRate)
+: capacity_(std::max<size_t>(capacity, 1)) {
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+        return;
+    }
+
+    // optimal filter for n keys: m = -n * ln(p) / ln(2)^2 bits, k = -log2(p) hashes
+    const double ln2 = std::log(2.0);
+    const double bits = -static_cast<double>(capacity_) * std::log(falsePositiveRate) / (ln2 * ln2);
+
+    bitsCount_ = (static_cast<size_t>(std::ceil(bits)) + kWordBits - 1) / kWordBits * kWordBits;
+    hashesCount_ = std::clamp<size_t>(static_cast<size_t>(std::lround(-std::log2(falsePositiveRate))), 1, kMaxHashesCount);
+
+    for (auto& generation : generations_) {
+        generation.bits.assign(bitsCount_ / kWordBits, 0);
+    }
+}
+
+uint64_t DuplicateFilter::getKey(const uint8_t* data, size_t size) {
+    return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(data), size));
+}
+
+bool DuplicateFilter::testAndAdd(uint64_t key) {
+    if (!isEnabled()) {
+        return false;
+    }
+
+    auto& current = generations_[current_];
+
+    if (contains(current, key) || contains(generations_[current_ ^ 1], key)) {
+        return true;
+    }
+
+    if (current.count >= capacity_) {
+        rotate();
+    }
+
+    add(generations_[current_], key);
+    return false;
+}
+
+void DuplicateFilter::rotate() {
+    current_ ^= 1;
+
+    auto& current = generations_[current_];
+    std::fill(current.bits.begin(), current.bits.end(), 0);
+    current.count = 0;
+}
+
+bool DuplicateFilter::contains(const Generation& generation, uint64_t key) const {
+    const Probe probe(key);
+
+    for (size_t i = 0; i < hashesCount_; ++i) {
+        const size_t index = probe.index(i, bitsCount_);
+
+        if (!(generation.bits[index / kWordBits] & (1ull << (index % kWordBits)))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DuplicateFilter::add(Generation& generation, uint64_t key) {
+    const Probe probe(key);
+
+    for (size_t i = 0; i < hashesCount_; ++i) {
+        const size_t index = probe.index(i, bitsCount_);
+        generation.bits[index / kWordBits] |= 1ull << (index % kWordBits);
+    }
+
+    ++generation.count;
+}
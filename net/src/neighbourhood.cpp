@@ -1,5 +1,7 @@
 #include <neighbourhood.hpp>
 
+#include <algorithm>
+
 #include <cscrypto/cscrypto.hpp>
 #include <csnode/configholder.hpp>
 #include <csnode/conveyer.hpp>
@@ -42,19 +44,32 @@ void Neighbourhood::newPeerDiscovered(const cs::PublicKey& peer) {
 void Neighbourhood::peerDisconnected(const cs::PublicKey& peer) {
     removeFromCompatiblePool(peer);
 
+    {
+        std::lock_guard lock(qualityMux_);
+        qualities_.erase(peer);
+    }
+
     if (remove(peer)) {
         addFromCompatiblePool();
     }
 }
 
 void Neighbourhood::pingNeighbours() {
-    std::lock_guard lock(neighbourMutex_);
-    for (auto& n : neighbours_) {
-        sendPing(n.first);
+    {
+        std::lock_guard lock(neighbourMutex_);
+        for (auto& n : neighbours_) {
+            sendPing(n.first);
+        }
+    }
+
+    // candidates asked before may not reply, the next ones are asked while there are free slots
+    if (!isLimitReached()) {
+        addFromCompatiblePool();
     }
 }
 
 void Neighbourhood::sendVersionRequest(const cs::PublicKey& receiver) {
+    onRequestSent(receiver);
     transport_->sendDirect(formPacket(BaseFlags::NetworkMsg,
                                       NetworkCommand::VersionRequest), receiver);
 }
@@ -65,11 +80,14 @@ void Neighbourhood::sendVersionReply(const cs::PublicKey& receiver) {
                                       NODE_VERSION,
                                       node_->getBlockChain().uuid(),
                                       node_->getBlockChain().getLastSeq(),
-                                      cs::Conveyer::instance().currentRoundNumber()),
+                                      cs::Conveyer::instance().currentRoundNumber(),
+                                      static_cast<cs::Byte>(PacketCompressor::kNewestMethod),
+                                      true /* splits frames */),
                            receiver);
 }
 
 void Neighbourhood::sendPing(const cs::PublicKey& receiver) {
+    onRequestSent(receiver);
     transport_->sendDirect(formPacket(BaseFlags::NetworkMsg, NetworkCommand::Ping), receiver);
 }
 
@@ -92,8 +110,20 @@ void Neighbourhood::gotVersionReply(const cs::PublicKey& sender, const Packet& p
     stream >> info.uuid;
     stream >> info.lastSeq;
     stream >> info.roundNumber;
+
+    // previous versions do not send pack method
+    if (stream.isAvailable(sizeof(info.packMethod))) {
+        stream >> info.packMethod;
+    }
+
+    // unknown network commands are banned by previous versions, so frames are sent to peers which announce them
+    if (stream.isAvailable(sizeof(info.splitsFrames))) {
+        stream >> info.splitsFrames;
+    }
+
     info.permanent = isPermanent(sender);
 
+    onReplyReceived(sender);
     tryToAddNew(sender, info);
 }
 
@@ -118,6 +148,7 @@ void Neighbourhood::gotPong(const cs::PublicKey& sender, const Packet& pack) {
     }
 
     if (result) {
+        onReplyReceived(sender);
         emit neighbourPingReceived(sequence, sender);
     }
 }
@@ -178,10 +209,35 @@ void Neighbourhood::removeFromCompatiblePool(const cs::PublicKey& peer) {
     compatiblePeers_.erase(peer);
 }
 
+// free slots are taken by the first replies, so only the best candidates are asked at once,
+// the ones still not replied are asked again after all others and lose their delivery rate
 void Neighbourhood::addFromCompatiblePool() {
-    std::lock_guard lock(peersMux_);
-    for (auto& n : compatiblePeers_) {
-        sendVersionRequest(n);
+    std::vector<cs::PublicKey> candidates;
+
+    {
+        std::lock_guard lock(peersMux_);
+        candidates.assign(compatiblePeers_.begin(), compatiblePeers_.end());
+    }
+
+    sortByQuality(candidates);
+
+    {
+        std::lock_guard lock(qualityMux_);
+        std::stable_partition(candidates.begin(), candidates.end(), [this](const cs::PublicKey& candidate) {
+            auto iter = qualities_.find(candidate);
+            return iter == qualities_.end() || !iter->second.isAwaiting();
+        });
+    }
+
+    const size_t count = getNeighboursCount();
+    const size_t freeSlots = count < kMaxNeighbours ? kMaxNeighbours - count : 0;
+
+    if (candidates.size() > freeSlots + kSpareCandidates) {
+        candidates.resize(freeSlots + kSpareCandidates);
+    }
+
+    for (auto& candidate : candidates) {
+        sendVersionRequest(candidate);
     }
 }
 
@@ -217,6 +273,81 @@ bool Neighbourhood::contains(const cs::PublicKey& neighbour) const {
     return neighbours_.find(neighbour) != neighbours_.end();
 }
 
+PacketCompressor::Method Neighbourhood::getPackMethod(const cs::PublicKey& neighbour) const {
+    std::lock_guard<std::mutex> lock(neighbourMutex_);
+    auto iter = neighbours_.find(neighbour);
+    return iter != neighbours_.end() ? static_cast<PacketCompressor::Method>(iter->second.packMethod) : PacketCompressor::Method::None;
+}
+
+bool Neighbourhood::canSplitFrames(const cs::PublicKey& neighbour) const {
+    std::lock_guard<std::mutex> lock(neighbourMutex_);
+    auto iter = neighbours_.find(neighbour);
+    return iter != neighbours_.end() && iter->second.splitsFrames;
+}
+
+PeerQuality Neighbourhood::getQuality(const cs::PublicKey& peer) const {
+    std::lock_guard lock(qualityMux_);
+    auto iter = qualities_.find(peer);
+    return iter != qualities_.end() ? iter->second : PeerQuality{};
+}
+
+std::vector<cs::PublicKey> Neighbourhood::getBestNeighbours(size_t count) const {
+    std::vector<cs::PublicKey> neighbours;
+
+    {
+        std::lock_guard lock(neighbourMutex_);
+        neighbours.reserve(neighbours_.size());
+
+        for (const auto& neighbour : neighbours_) {
+            neighbours.push_back(neighbour.first);
+        }
+    }
+
+    sortByQuality(neighbours);
+
+    if (neighbours.size() > count) {
+        neighbours.resize(count);
+    }
+
+    return neighbours;
+}
+
+void Neighbourhood::onRequestSent(const cs::PublicKey& peer) {
+    std::lock_guard lock(qualityMux_);
+    qualities_[peer].onRequest(PeerQuality::Clock::now());
+}
+
+void Neighbourhood::onReplyReceived(const cs::PublicKey& peer) {
+    std::lock_guard lock(qualityMux_);
+    auto iter = qualities_.find(peer);
+
+    if (iter != qualities_.end()) {
+        iter->second.onReply(PeerQuality::Clock::now());
+    }
+}
+
+void Neighbourhood::sortByQuality(std::vector<cs::PublicKey>& peers) const {
+    std::vector<std::pair<PeerQuality, cs::PublicKey>> ranked;
+    ranked.reserve(peers.size());
+
+    {
+        std::lock_guard lock(qualityMux_);
+
+        for (const auto& peer : peers) {
+            auto iter = qualities_.find(peer);
+            ranked.emplace_back(iter != qualities_.end() ? iter->second : PeerQuality{}, peer);
+        }
+    }
+
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+        return PeerQuality::isBetter(lhs.first, rhs.first);
+    });
+
+    for (size_t i = 0; i < peers.size(); ++i) {
+        peers[i] = ranked[i].second;
+    }
+}
+
 void Neighbourhood::add(const std::set<cs::PublicKey>& keys) {
     for (auto& key : keys) {
         if (!contains(key)) {
@@ -12,6 +12,8 @@ const char* networkCommandToString(NetworkCommand command) {
         return "Ping";
     case NetworkCommand::Pong:
         return "Pong";
+    case NetworkCommand::Frame:
+        return "Frame";
     default:
         return "Unknown";
     }
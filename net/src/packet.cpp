@@ -112,5 +112,9 @@ std::ostream& operator<<(std::ostream& os, const Packet& packet) {
         flags += " signed";
     }
 
+    if (packet.isPacked()) {
+        flags += " packed";
+    }
+
     return os << flags << std::endl;
 }
@@ -0,0 +1,171 @@
+#include "packetcoalescer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+uint64_t toUs(PacketCoalescer::Clock::duration duration) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+}  // namespace
+
+bool PacketCoalescer::isFrame(const Packet& pack) {
+    return pack.size() >= kFrameHeaderSize && pack.getNetworkCommand() == NetworkCommand::Frame;
+}
+
+bool PacketCoalescer::split(const Packet& frame, std::vector<Packet>& packets) {
+    auto data = static_cast<const cs::Byte*>(frame.data());
+    size_t offset = kFrameHeaderSize;
+
+    while (offset < frame.size()) {
+        uint32_t size = 0;
+
+        if (frame.size() - offset < kMessageHeaderSize) {
+            return false;
+        }
+
+        std::memcpy(&size, data + offset, kMessageHeaderSize);
+        offset += kMessageHeaderSize;
+
+        if (size == 0 || frame.size() - offset < size) {
+            return false;
+        }
+
+        Packet pack(cs::Bytes(data + offset, data + offset + size));
+        offset += size;
+
+        // frames are never nested
+        if (isFrame(pack)) {
+            return false;
+        }
+
+        packets.push_back(std::move(pack));
+    }
+
+    return !packets.empty();
+}
+
+PacketCoalescer::PacketCoalescer()
+: PacketCoalescer(Settings{}) {
+}
+
+PacketCoalescer::PacketCoalescer(const Settings& settings)
+: settings_(settings) {
+}
+
+bool PacketCoalescer::isCoalescable(const Packet& pack) const {
+    return !pack.isNetwork() && pack.size() <= settings_.maxMessageSize;
+}
+
+bool PacketCoalescer::add(const cs::PublicKey& receiver, const Packet& pack, Clock::time_point now, Frames& ready) {
+    auto& frame = frames_[receiver];
+
+    if (frame.messages && frame.data.size() + kMessageHeaderSize + pack.size() > settings_.maxFrameSize) {
+        take(receiver, frame, now, ready);
+    }
+
+    const bool started = frame.messages == 0;
+
+    if (started) {
+        frame.data.reserve(settings_.maxFrameSize);
+        frame.data.push_back(BaseFlags::NetworkMsg);
+        frame.data.push_back(static_cast<cs::Byte>(NetworkCommand::Frame));
+        frame.start = now;
+    }
+
+    const auto size = static_cast<uint32_t>(pack.size());
+    auto data = static_cast<const cs::Byte*>(pack.data());
+    auto sizeData = reinterpret_cast<const cs::Byte*>(&size);
+
+    frame.data.insert(frame.data.end(), sizeData, sizeData + kMessageHeaderSize);
+    frame.data.insert(frame.data.end(), data, data + pack.size());
+
+    ++frame.messages;
+    frame.delays += now - frame.start;
+
+    if (frame.data.size() >= settings_.maxFrameSize) {
+        take(receiver, frame, now, ready);
+        frames_.erase(receiver);
+    }
+
+    return started;
+}
+
+void PacketCoalescer::take(const cs::PublicKey& receiver, Clock::time_point now, Frames& ready) {
+    auto iter = frames_.find(receiver);
+
+    if (iter != frames_.end()) {
+        take(receiver, iter->second, now, ready);
+        frames_.erase(iter);
+    }
+}
+
+void PacketCoalescer::takeExpired(Clock::time_point now, Frames& ready) {
+    for (auto iter = frames_.begin(); iter != frames_.end();) {
+        if (iter->second.start + settings_.latency <= now) {
+            take(iter->first, iter->second, now, ready);
+            iter = frames_.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+void PacketCoalescer::takeAll(Clock::time_point now, Frames& ready) {
+    for (auto& [receiver, frame] : frames_) {
+        take(receiver, frame, now, ready);
+    }
+
+    frames_.clear();
+}
+
+std::optional<PacketCoalescer::Clock::time_point> PacketCoalescer::nextDeadline() const {
+    std::optional<Clock::time_point> deadline;
+
+    for (const auto& [receiver, frame] : frames_) {
+        if (!deadline || frame.start + settings_.latency < *deadline) {
+            deadline = frame.start + settings_.latency;
+        }
+    }
+
+    return deadline;
+}
+
+bool PacketCoalescer::empty() const {
+    return frames_.empty();
+}
+
+size_t PacketCoalescer::receivers() const {
+    return frames_.size();
+}
+
+const PacketCoalescer::Metrics& PacketCoalescer::getMetrics() const {
+    return metrics_;
+}
+
+// frame of one message is sent as the message itself, the frame is left empty for the caller to erase or reuse
+void PacketCoalescer::take(const cs::PublicKey& receiver, Frame& frame, Clock::time_point now, Frames& ready) {
+    if (frame.messages == 0) {
+        return;
+    }
+
+    const auto latency = now - frame.start;
+    metrics_.latencyUs += toUs(latency * static_cast<int>(frame.messages) - frame.delays);
+    metrics_.maxLatencyUs = std::max(metrics_.maxLatencyUs, toUs(latency));
+
+    if (frame.messages == 1) {
+        ++metrics_.singleMessages;
+        ready.emplace_back(receiver, cs::Bytes(frame.data.begin() + static_cast<std::ptrdiff_t>(kFrameHeaderSize + kMessageHeaderSize), frame.data.end()));
+        frame.data.clear();
+    }
+    else {
+        ++metrics_.frames;
+        metrics_.framedMessages += frame.messages;
+        ready.emplace_back(receiver, std::move(frame.data));
+        frame.data = cs::Bytes{};
+    }
+
+    frame.messages = 0;
+    frame.delays = Clock::duration{};
+}
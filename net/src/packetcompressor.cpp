@@ -0,0 +1,150 @@
+#include "packetcompressor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <lz4.h>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedNs(Clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+}  // namespace
+
+bool PacketCompressor::isPackable(MsgTypes type) {
+    switch (type) {
+        case MsgTypes::RequestedBlock:
+        case MsgTypes::NodeStopRequest:
+            return false;
+        default:
+            return true;
+    }
+}
+
+PacketCompressor::Method PacketCompressor::getMethod(Method peerMethod) {
+    return std::min(peerMethod, kNewestMethod);
+}
+
+size_t PacketCompressor::getUnpackedSize(const Packet& packet) {
+    if (!packet.isPacked() || packet.getMsgSize() < kHeaderSize) {
+        return packet.size();
+    }
+
+    uint32_t originalSize = 0;
+    std::memcpy(&originalSize, packet.getMsgData() + sizeof(Method), sizeof(originalSize));
+
+    return packet.getHeadersLength() + originalSize;
+}
+
+bool PacketCompressor::pack(Packet& packet, Method method) const {
+    const auto type = packet.getType();
+    const size_t size = packet.getMsgSize();
+
+    if (method != Method::Lz4 || !isPackable(type) || packet.isPacked() || size < kMinPayloadSize || size > kMaxPayloadSize) {
+        return false;
+    }
+
+    const auto start = Clock::now();
+
+    const size_t headersLength = packet.getHeadersLength();
+    const int bound = LZ4_compressBound(static_cast<int>(size));
+
+    cs::Bytes result(headersLength + kHeaderSize + static_cast<size_t>(bound));
+
+    const auto data = static_cast<const cs::Byte*>(packet.data());
+    std::copy(data, data + headersLength, result.begin());
+
+    const int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(data + headersLength),
+                                                    reinterpret_cast<char*>(result.data() + headersLength + kHeaderSize),
+                                                    static_cast<int>(size), bound);
+
+    // incompressible payload is sent as is
+    if (compressedSize <= 0 || static_cast<size_t>(compressedSize) + kHeaderSize >= size) {
+        return false;
+    }
+
+    auto header = result.data() + headersLength;
+    const auto originalSize = static_cast<uint32_t>(size);
+
+    header[0] = method;
+    std::memcpy(header + sizeof(Method), &originalSize, sizeof(originalSize));
+
+    result[0] |= BaseFlags::Packed;
+    result.resize(headersLength + kHeaderSize + static_cast<size_t>(compressedSize));
+
+    auto& metrics = metrics_[type];
+    ++metrics.packed;
+    metrics.bytes += size;
+    metrics.packedBytes += result.size() - headersLength;
+    metrics.packTimeNs += elapsedNs(start);
+
+    packet = Packet(std::move(result));
+    return true;
+}
+
+bool PacketCompressor::unpack(Packet& packet) const {
+    if (!packet.isPacked()) {
+        return true;
+    }
+
+    const auto start = Clock::now();
+
+    const size_t headersLength = packet.getHeadersLength();
+    const size_t size = packet.getMsgSize();
+
+    if (size < kHeaderSize) {
+        return false;
+    }
+
+    const auto header = packet.getMsgData();
+    const auto method = static_cast<Method>(header[0]);
+
+    uint32_t originalSize = 0;
+    std::memcpy(&originalSize, header + sizeof(Method), sizeof(originalSize));
+
+    // buffer for original payload is allocated ahead, so its size is bounded by the packed one
+    if (method != Method::Lz4 || originalSize > kMaxPayloadSize || originalSize > (size - kHeaderSize) * kMaxRatio) {
+        return false;
+    }
+
+    cs::Bytes result(headersLength + originalSize);
+
+    const auto data = static_cast<const cs::Byte*>(packet.data());
+    std::copy(data, data + headersLength, result.begin());
+
+    const auto source = reinterpret_cast<const char*>(header + kHeaderSize);
+    const auto target = reinterpret_cast<char*>(result.data() + headersLength);
+    const int sourceSize = static_cast<int>(size - kHeaderSize);
+
+    const int decompressedSize = LZ4_decompress_safe(source, target, sourceSize, static_cast<int>(originalSize));
+
+    if (decompressedSize != static_cast<int>(originalSize)) {
+        return false;
+    }
+
+    result[0] &= static_cast<cs::Byte>(~BaseFlags::Packed);
+
+    auto& metrics = metrics_[packet.getType()];
+    ++metrics.unpacked;
+    metrics.unpackTimeNs += elapsedNs(start);
+
+    packet = Packet(std::move(result));
+    return true;
+}
+
+PacketCompressor::Metrics PacketCompressor::getMetrics(MsgTypes type) const {
+    const auto& data = metrics_[type];
+
+    Metrics metrics;
+    metrics.packed = data.packed;
+    metrics.bytes = data.bytes;
+    metrics.packedBytes = data.packedBytes;
+    metrics.packTimeNs = data.packTimeNs;
+    metrics.unpacked = data.unpacked;
+    metrics.unpackTimeNs = data.unpackTimeNs;
+
+    return metrics;
+}
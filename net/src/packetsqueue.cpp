@@ -1,50 +1,134 @@
 #include "packetsqueue.hpp"
 
-#include <stdexcept>
+PacketsQueue::PacketsQueue(size_t capacity)
+: firstPriorityQ_(capacity)
+, secondPriorityQ_(capacity)
+, maxSize_(capacity * 2) {
+}
 
 bool PacketsQueue::empty() const {
-    return firstPriorityQ_.empty() && secondPriorityQ_.empty();
+    return firstPriorityQ_.empty() && secondPriorityQ_.empty() && firstPriorityScheduler_.empty() && secondPriorityScheduler_.empty();
 }
 
-PacketsQueue::SenderAndPacket PacketsQueue::pop() {
-    SenderAndPacket result;
+bool PacketsQueue::pop(SenderAndPacket& result) {
+    SenderAndPacket value;
+
+    while (firstPriorityQ_.pop(value)) {
+        firstPriorityScheduler_.push(std::move(value));
+    }
 
-    if (!firstPriorityQ_.empty()) {
-        result.first = firstPriorityQ_.front().first;
-        result.second = std::move(firstPriorityQ_.front().second);
-        firstPriorityQ_.pop_front();
-        firstQBytes_ -= result.second.size();
-        return result;
+    while (secondPriorityQ_.pop(value)) {
+        secondPriorityScheduler_.push(std::move(value));
     }
 
-    if (!secondPriorityQ_.empty()) {
-        result.first = secondPriorityQ_.front().first;
-        result.second = std::move(secondPriorityQ_.front().second);
-        secondPriorityQ_.pop_front();
-        secondQBytes_ -= result.second.size();
-        return result;
+    if (!firstPriorityScheduler_.pop(result) && !secondPriorityScheduler_.pop(result)) {
+        return false;
     }
 
-    throw std::domain_error("PacketsQueue is empty.");
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    bytes_.fetch_sub(result.second.size(), std::memory_order_relaxed);
+    return true;
 }
 
-void PacketsQueue::push(const cs::PublicKey& sender, Packet&& pack) {
-    auto priority = getPriority(pack.getType());
+bool PacketsQueue::push(const cs::PublicKey& sender, Packet&& pack) {
+    const auto priority = getPriority(pack.getType());
+    const size_t packSize = pack.size();
+
+    // rings are drained by the worker, so packets waiting for their turn are limited here,
+    // counters are reserved before packet is published, so pop never gets ahead of them
+    if (!reserve(size_, 1, maxSize_)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (!reserve(bytes_, packSize, priority == Priority::kFirst ? kMaxBytesToHandle : kMaxSecondPriorityBytes)) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    SenderAndPacket value(sender, std::move(pack));
+    auto& queue = priority == Priority::kFirst ? firstPriorityQ_ : secondPriorityQ_;
 
-    if (!shrink()) {
-        if (priority == Priority::kSecond) return;
-        firstPriorityQ_.clear();
-        firstQBytes_ = 0;
+    if (!queue.push(std::move(value))) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        bytes_.fetch_sub(packSize, std::memory_order_relaxed);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
 
-    if (priority == Priority::kFirst) {
-        firstQBytes_ += pack.size();
-        firstPriorityQ_.push_back({sender, std::move(pack)});
+    return true;
+}
+
+size_t PacketsQueue::size() const {
+    return size_.load(std::memory_order_relaxed);
+}
+
+size_t PacketsQueue::bytes() const {
+    return bytes_.load(std::memory_order_relaxed);
+}
+
+size_t PacketsQueue::dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool PacketsQueue::reserve(std::atomic<size_t>& counter, size_t amount, size_t limit) {
+    size_t current = counter.load(std::memory_order_relaxed);
+
+    do {
+        if (current + amount > limit) {
+            return false;
+        }
+    } while (!counter.compare_exchange_weak(current, current + amount, std::memory_order_relaxed));
+
+    return true;
+}
+
+void PacketsQueue::Scheduler::push(SenderAndPacket&& value) {
+    auto& sender = senders[value.first];
+
+    if (sender.packets.empty()) {
+        turns.push_back(value.first);
     }
-    else {
-        secondQBytes_ += pack.size();
-        secondPriorityQ_.push_back({sender, std::move(pack)});
+
+    sender.packets.push_back(std::move(value.second));
+}
+
+bool PacketsQueue::Scheduler::pop(SenderAndPacket& result) {
+    while (!turns.empty()) {
+        const cs::PublicKey key = turns.front();
+        auto& sender = senders[key];
+
+        if (!granted) {
+            sender.deficit += kQuantum;
+            granted = true;
+        }
+
+        const size_t packSize = sender.packets.front().size();
+
+        if (packSize > sender.deficit) {
+            // keeps deficit, so a large packet goes in one of the next turns
+            turns.pop_front();
+            turns.push_back(key);
+            granted = false;
+            continue;
+        }
+
+        sender.deficit -= packSize;
+        result.first = key;
+        result.second = std::move(sender.packets.front());
+        sender.packets.pop_front();
+
+        if (sender.packets.empty()) {
+            senders.erase(key);
+            turns.pop_front();
+            granted = false;
+        }
+
+        return true;
     }
+
+    return false;
 }
 
 PacketsQueue::Priority PacketsQueue::getPriority(MsgTypes type) const {
@@ -77,20 +161,3 @@ PacketsQueue::Priority PacketsQueue::getPriority(MsgTypes type) const {
             return Priority::kSecond;
     }
 }
-
-size_t PacketsQueue::numPackets() const {
-    return firstPriorityQ_.size() + secondPriorityQ_.size();
-}
-
-size_t PacketsQueue::numBytes() const {
-    return firstQBytes_ + secondQBytes_;
-}
-
-bool PacketsQueue::shrink() {
-  if ((numPackets() > kMaxPacketsToHandle) || (numBytes() > kMaxBytesToHandle)) {
-    secondPriorityQ_.clear();
-    secondQBytes_ = 0;
-  }
-
-  return (numPackets() <= kMaxPacketsToHandle) && (numBytes() <= kMaxBytesToHandle);
-}
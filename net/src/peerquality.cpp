@@ -0,0 +1,66 @@
+#include "peerquality.hpp"
+
+#include <algorithm>
+
+namespace {
+// weight of a new sample in delivery rate
+constexpr double kDeliveryWeight = 0.125;
+
+// delivery rate never drops score below this share
+constexpr double kMinDeliveryRate = 0.1;
+
+PeerQuality::Duration absolute(PeerQuality::Duration duration) {
+    return duration < PeerQuality::Duration::zero() ? -duration : duration;
+}
+}  // namespace
+
+void PeerQuality::onRequest(Clock::time_point now) {
+    if (requestSent_) {
+        deliveryRate_ -= deliveryRate_ * kDeliveryWeight;
+    }
+
+    requestSent_ = now;
+}
+
+bool PeerQuality::onReply(Clock::time_point now) {
+    if (!requestSent_) {
+        return false;
+    }
+
+    const Duration sample = std::max(now - *requestSent_, Duration::zero());
+    requestSent_.reset();
+
+    if (!measured_) {
+        rtt_ = sample;
+        jitter_ = sample / 2;
+        measured_ = true;
+    }
+    else {
+        jitter_ = (jitter_ * 3 + absolute(rtt_ - sample)) / 4;
+        rtt_ = (rtt_ * 7 + sample) / 8;
+    }
+
+    deliveryRate_ += (1.0 - deliveryRate_) * kDeliveryWeight;
+    return true;
+}
+
+PeerQuality::Duration PeerQuality::score() const {
+    if (!measured_) {
+        return Duration::max();
+    }
+
+    const double expected = static_cast<double>((rtt_ + jitter_ * 4).count()) / std::max(deliveryRate_, kMinDeliveryRate);
+    return Duration(static_cast<Duration::rep>(expected));
+}
+
+bool PeerQuality::isBetter(const PeerQuality& lhs, const PeerQuality& rhs) {
+    if (lhs.measured_ != rhs.measured_) {
+        return lhs.measured_;
+    }
+
+    if (!lhs.measured_) {
+        return lhs.deliveryRate_ > rhs.deliveryRate_;
+    }
+
+    return lhs.score() < rhs.score();
+}
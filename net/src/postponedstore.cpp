@@ -0,0 +1,109 @@
+#include "postponedstore.hpp"
+
+#include <iterator>
+
+PostponedStore::PostponedStore()
+: PostponedStore(kMaxBytes, kMaxSenderBytes) {
+}
+
+PostponedStore::PostponedStore(size_t maxBytes, size_t maxSenderBytes)
+: maxBytes_(maxBytes)
+, maxSenderBytes_(maxSenderBytes) {
+}
+
+bool PostponedStore::add(const cs::PublicKey& sender, cs::RoundNumber round, Packet&& pack) {
+    const size_t size = pack.size();
+    auto& senderBytes = senderBytes_[sender];
+
+    if (size > maxBytes_ || senderBytes + size > maxSenderBytes_) {
+        if (senderBytes == 0) {
+            senderBytes_.erase(sender);
+        }
+
+        ++rejected_;
+        return false;
+    }
+
+    while (bytes_ + size > maxBytes_) {
+        if (!evictAfter(round)) {
+            if (senderBytes_[sender] == 0) {
+                senderBytes_.erase(sender);
+            }
+
+            ++rejected_;
+            return false;
+        }
+    }
+
+    // eviction may release packets of the sender and forget it, so it is looked up again
+    senderBytes_[sender] += size;
+    bytes_ += size;
+    ++packets_;
+
+    rounds_[round].push_back(PostponedPack{sender, std::move(pack)});
+    return true;
+}
+
+PostponedStore::Packs PostponedStore::take(cs::RoundNumber round) {
+    Packs result;
+    const auto end = rounds_.upper_bound(round);
+
+    for (auto iter = rounds_.begin(); iter != end; ++iter) {
+        for (const auto& postponed : iter->second) {
+            release(postponed);
+        }
+
+        if (iter->first == round) {
+            result = std::move(iter->second);
+        }
+    }
+
+    rounds_.erase(rounds_.begin(), end);
+    return result;
+}
+
+PostponedStore::Metrics PostponedStore::getMetrics() const {
+    Metrics metrics;
+    metrics.packets = packets_;
+    metrics.bytes = bytes_;
+    metrics.rounds = rounds_.size();
+    metrics.evicted = evicted_;
+    metrics.rejected = rejected_;
+
+    return metrics;
+}
+
+void PostponedStore::release(const PostponedPack& postponed) {
+    const size_t size = postponed.pack.size();
+    auto iter = senderBytes_.find(postponed.sender);
+
+    if (iter != senderBytes_.end()) {
+        iter->second -= size;
+
+        if (iter->second == 0) {
+            senderBytes_.erase(iter);
+        }
+    }
+
+    bytes_ -= size;
+    --packets_;
+}
+
+bool PostponedStore::evictAfter(cs::RoundNumber round) {
+    if (rounds_.empty() || rounds_.rbegin()->first <= round) {
+        return false;
+    }
+
+    auto iter = std::prev(rounds_.end());
+    auto& packs = iter->second;
+
+    release(packs.back());
+    packs.pop_back();
+    ++evicted_;
+
+    if (packs.empty()) {
+        rounds_.erase(iter);
+    }
+
+    return true;
+}
@@ -0,0 +1,94 @@
+#include "senderlimiter.hpp"
+
+#include <algorithm>
+
+namespace {
+constexpr double kDefaultRate = 8 * 1024 * 1024;
+constexpr size_t kDefaultBurst = 32 * 1024 * 1024;
+}  // namespace
+
+SenderLimiter::SenderLimiter()
+: SenderLimiter(kDefaultRate, kDefaultBurst) {
+}
+
+SenderLimiter::SenderLimiter(double rate, size_t burst)
+: rate_(rate)
+, burst_(static_cast<double>(burst)) {
+}
+
+void SenderLimiter::setLimits(double rate, size_t burst) {
+    std::lock_guard lock(mux_);
+    rate_ = rate;
+    burst_ = static_cast<double>(burst);
+}
+
+bool SenderLimiter::take(const cs::PublicKey& sender, size_t bytes, Clock::time_point now) {
+    const double cost = static_cast<double>(bytes + kPacketCost);
+
+    std::lock_guard lock(mux_);
+    auto [iter, inserted] = buckets_.try_emplace(sender);
+    auto& bucket = iter->second;
+
+    if (inserted) {
+        bucket.tokens = burst_;
+        bucket.updated = now;
+    }
+    else {
+        refill(bucket, now);
+    }
+
+    // a full bucket lets a packet larger than burst through in debt
+    if (bucket.tokens < cost && bucket.tokens < burst_) {
+        ++bucket.counters.throttled;
+        bucket.counters.throttledBytes += bytes;
+        throttled_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bucket.tokens -= cost;
+    return true;
+}
+
+void SenderLimiter::prune(Clock::time_point now) {
+    std::lock_guard lock(mux_);
+    const bool overflow = buckets_.size() > kMaxBuckets;
+
+    for (auto iter = buckets_.begin(); iter != buckets_.end();) {
+        auto& bucket = iter->second;
+        refill(bucket, now);
+
+        if (bucket.tokens >= burst_ && (overflow || bucket.counters.throttled == 0)) {
+            iter = buckets_.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+uint64_t SenderLimiter::throttled() const {
+    return throttled_.load(std::memory_order_relaxed);
+}
+
+std::vector<SenderLimiter::SenderCounters> SenderLimiter::getThrottledSenders() const {
+    std::vector<SenderCounters> result;
+    std::lock_guard lock(mux_);
+
+    for (const auto& [key, bucket] : buckets_) {
+        if (bucket.counters.throttled) {
+            result.emplace_back(key, bucket.counters);
+        }
+    }
+
+    return result;
+}
+
+void SenderLimiter::refill(Bucket& bucket, Clock::time_point now) const {
+    if (now <= bucket.updated) {
+        return;
+    }
+
+    const double seconds = std::chrono::duration<double>(now - bucket.updated).count();
+    bucket.tokens = std::min(burst_, bucket.tokens + seconds * rate_);
+    bucket.updated = now;
+}
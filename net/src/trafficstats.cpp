@@ -0,0 +1,108 @@
+#include "trafficstats.hpp"
+
+#include <lib/system/logger.hpp>
+
+namespace {
+constexpr auto kOrder = std::memory_order_relaxed;
+}  // namespace
+
+size_t TrafficStats::getHistogramBucket(uint64_t durationUs) {
+    size_t bucket = 0;
+
+    for (uint64_t bound = 10; bucket < kHistogramSize - 1 && durationUs >= bound; bound *= 10) {
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+const char* TrafficStats::getHistogramBucketName(size_t bucket) {
+    static const char* names[kHistogramSize] = {"<10us", "<100us", "<1ms", "<10ms", "<100ms", "<1s", ">=1s"};
+    return bucket < kHistogramSize ? names[bucket] : "";
+}
+
+void TrafficStats::onReceived(MsgTypes type, size_t bytes, size_t unpackedBytes) {
+    auto& counters = counters_[type];
+    counters.packetsIn.fetch_add(1, kOrder);
+    counters.bytesIn.fetch_add(bytes, kOrder);
+    counters.unpackedBytesIn.fetch_add(unpackedBytes, kOrder);
+}
+
+void TrafficStats::onSent(MsgTypes type, size_t bytes, size_t unpackedBytes, size_t receiversCount) {
+    auto& counters = counters_[type];
+    counters.packetsOut.fetch_add(receiversCount, kOrder);
+    counters.bytesOut.fetch_add(bytes * receiversCount, kOrder);
+    counters.unpackedBytesOut.fetch_add(unpackedBytes * receiversCount, kOrder);
+}
+
+void TrafficStats::onDropped(MsgTypes type) {
+    counters_[type].dropped.fetch_add(1, kOrder);
+}
+
+void TrafficStats::onDuplicate(MsgTypes type) {
+    counters_[type].duplicates.fetch_add(1, kOrder);
+}
+
+void TrafficStats::onThrottled(MsgTypes type) {
+    counters_[type].throttled.fetch_add(1, kOrder);
+}
+
+void TrafficStats::onRejected(MsgTypes type) {
+    counters_[type].rejected.fetch_add(1, kOrder);
+}
+
+void TrafficStats::onHandled(MsgTypes type, uint64_t durationUs) {
+    auto& counters = counters_[type];
+    counters.handled.fetch_add(1, kOrder);
+    counters.handlingTimeUs.fetch_add(durationUs, kOrder);
+    counters.handlingTimeHistogram[getHistogramBucket(durationUs)].fetch_add(1, kOrder);
+}
+
+TrafficStats::Counters TrafficStats::get(MsgTypes type) const {
+    const auto& counters = counters_[type];
+
+    Counters result;
+    result.packetsIn = counters.packetsIn.load(kOrder);
+    result.bytesIn = counters.bytesIn.load(kOrder);
+    result.unpackedBytesIn = counters.unpackedBytesIn.load(kOrder);
+    result.packetsOut = counters.packetsOut.load(kOrder);
+    result.bytesOut = counters.bytesOut.load(kOrder);
+    result.unpackedBytesOut = counters.unpackedBytesOut.load(kOrder);
+    result.dropped = counters.dropped.load(kOrder);
+    result.duplicates = counters.duplicates.load(kOrder);
+    result.throttled = counters.throttled.load(kOrder);
+    result.rejected = counters.rejected.load(kOrder);
+    result.handled = counters.handled.load(kOrder);
+    result.handlingTimeUs = counters.handlingTimeUs.load(kOrder);
+
+    for (size_t i = 0; i < kHistogramSize; ++i) {
+        result.handlingTimeHistogram[i] = counters.handlingTimeHistogram[i].load(kOrder);
+    }
+
+    return result;
+}
+
+void TrafficStats::print() const {
+    for (size_t i = 0; i < kMsgTypesCount; ++i) {
+        const auto type = static_cast<MsgTypes>(i);
+        const auto counters = get(type);
+
+        if (counters.packetsIn == 0 && counters.packetsOut == 0 && counters.rejected == 0) {
+            continue;
+        }
+
+        std::string histogram;
+
+        for (size_t bucket = 0; bucket < kHistogramSize; ++bucket) {
+            if (counters.handlingTimeHistogram[bucket]) {
+                histogram += std::string(" ") + getHistogramBucketName(bucket) + ":" + std::to_string(counters.handlingTimeHistogram[bucket]);
+            }
+        }
+
+        cslog() << "Traffic> " << Packet::messageTypeToString(type)
+                << ": in " << counters.packetsIn << " (" << WithDelimiters(counters.bytesIn) << " of " << WithDelimiters(counters.unpackedBytesIn) << " bytes)"
+                << ", out " << counters.packetsOut << " (" << WithDelimiters(counters.bytesOut) << " of " << WithDelimiters(counters.unpackedBytesOut) << " bytes)"
+                << ", dropped " << counters.dropped << ", duplicates " << counters.duplicates << ", throttled " << counters.throttled << ", rejected " << counters.rejected
+                << ", handled " << counters.handled << " in " << WithDelimiters(counters.handlingTimeUs) << " us," << histogram;
+    }
+}
@@ -2,6 +2,8 @@
 #include "transport.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <thread>
 
 #include <cscrypto/cscrypto.hpp>
@@ -30,6 +32,19 @@ net::NodeId toNodeId(const cs::PublicKey& key) {
     return ret;
 }
 
+struct LaneLimits {
+    double rate; // bytes per second
+    size_t burst;
+};
+
+// ceilings for a single sender, far above traffic of a healthy neighbour
+constexpr std::array<LaneLimits, static_cast<size_t>(Transport::Lane::Count)> kLaneLimits = {{
+    {8.0 * 1024 * 1024, 32ul * 1024 * 1024}, // consensus
+    {8.0 * 1024 * 1024, 32ul * 1024 * 1024}, // transactions
+    {32.0 * 1024 * 1024, 128ul * 1024 * 1024}, // sync
+    {4.0 * 1024 * 1024, 16ul * 1024 * 1024} // misc
+}};
+
 net::Config createNetConfig(bool& good) {
     auto config = *cs::ConfigHolder::instance().config();
     net::Config result(toNodeId(config.getMyPublicKey()));
@@ -97,26 +112,48 @@ extern void pollSignalFlag();
 Transport::Transport(Node* node)
 : config_(createNetConfig(good_))
 , node_(node)
+, duplicateFilter_(DuplicateFilter::kDefaultCapacity, cs::ConfigHolder::instance().config()->duplicatesFalsePositiveRate())
 , neighbourhood_(this, node_)
 , host_(config_, static_cast<HostEventHandler&>(*this)) {
     cs::Connector::connect(&neighbourhood_.neighbourPingReceived, this, &Transport::onPingReceived);
+    for (size_t i = 0; i < kLanesCount; ++i) {
+        const auto& limits = kLaneLimits[i];
+        lanes_[i].limiter.setLimits(limits.rate, limits.burst);
+    }
 }
 
 Transport::~Transport() {
-    if (processorThread_.joinable()) {
-        processorThread_.join();
+    for (auto& lane : lanes_) {
+        if (lane.worker.joinable()) {
+            lane.worker.join();
+        }
+    }
+
+    if (coalescerWorker_.joinable()) {
+        coalescerWorker_.join();
     }
 }
 
 void Transport::run() {
     host_.Run();
-    processorThread_ = std::thread(&Transport::processorRoutine, this);
+
+    for (size_t i = 0; i < kLanesCount; ++i) {
+        lanes_[i].worker = std::thread(&Transport::laneRoutine, this, static_cast<Lane>(i));
+    }
+
+    coalescerWorker_ = std::thread(&Transport::coalescerRoutine, this);
+
     std::this_thread::sleep_for(Neighbourhood::kPingInterval);
 
     while (Transport::gSignalStatus == 0) {
         pollSignalFlag();
 
         neighbourhood_.pingNeighbours();
+        printTrafficStats();
+
+        for (auto& lane : lanes_) {
+            lane.limiter.prune(SenderLimiter::Clock::now());
+        }
 
         emit mainThreadIterated();
         std::this_thread::sleep_for(Neighbourhood::kPingInterval);
@@ -125,22 +162,71 @@ void Transport::run() {
 
 void Transport::OnMessageReceived(const net::NodeId& id, net::ByteVector&& data) {
     Packet pack(std::move(data));
-    if (!cs::PacketValidator::validate(pack)) {
+    if (!validate(pack)) {
         return;
     }
 
     auto publicKey = toPublicKey(id);
+
+    if (PacketCoalescer::isFrame(pack)) {
+        std::vector<Packet> packets;
+
+        if (!PacketCoalescer::split(pack, packets)) {
+            cswarning() << "Transport> malformed frame from " << cs::Utils::byteStreamToHex(publicKey);
+            return;
+        }
+
+        for (auto& framed : packets) {
+            if (validate(framed)) {
+                receivePacket(publicKey, std::move(framed));
+            }
+        }
+
+        return;
+    }
+
+    receivePacket(publicKey, std::move(pack));
+}
+
+bool Transport::validate(const Packet& pack) {
+    if (cs::PacketValidator::validate(pack)) {
+        return true;
+    }
+
+    if (pack.isHeaderValid() && !pack.isNetwork()) {
+        trafficStats_.onRejected(pack.getType());
+    }
+
+    return false;
+}
+
+void Transport::receivePacket(const cs::PublicKey& publicKey, Packet&& pack) {
     if (pack.isNetwork()) {
         neighbourhood_.processNeighbourMessage(publicKey, pack);
         return;
     }
 
+    const auto type = pack.getType();
+    trafficStats_.onReceived(type, pack.size(), PacketCompressor::getUnpackedSize(pack));
+
+    auto& lane = lanes_[static_cast<size_t>(getLane(type))];
+
+    if (!lane.limiter.take(publicKey, pack.size(), SenderLimiter::Clock::now())) {
+        trafficStats_.onThrottled(type);
+        return;
+    }
+
+    if (!lane.queue.push(publicKey, std::move(pack))) {
+        trafficStats_.onDropped(type);
+        return;
+    }
+
+    // worker checks queue under the lock before it sleeps, so notification is not lost
     {
-        std::lock_guard g(inboxMux_);
-        inboxQueue_.push(publicKey, std::move(pack));
+        std::lock_guard g(lane.mux);
     }
 
-    newPacketsReceived_.notify_one();
+    lane.packetsReceived.notify_one();
 }
 
 void Transport::OnNodeDiscovered(const net::NodeId& id) {
@@ -158,13 +244,23 @@ void Transport::onNeighboursChanged(const cs::PublicKey& neighbour, cs::Sequence
 }
 
 void Transport::onPingReceived(cs::Sequence sequence, const cs::PublicKey& key) {
+    const auto rtt = neighbourhood_.getQuality(key).rtt();
+
     cs::Concurrent::execute(cs::RunPolicy::CallQueuePolicy, [=] {
         emit pingReceived(sequence, key);
+        emit neighbourRttUpdated(key, rtt);
     });
 }
 
 void Transport::sendDirect(Packet&& pack, const cs::PublicKey& receiver) {
-    host_.SendDirect(toNodeId(receiver), pack.moveData());
+    const size_t unpackedSize = pack.size();
+    compressor_.pack(pack, getPackMethod(pack, receiver));
+
+    if (!pack.isNetwork()) {
+        trafficStats_.onSent(pack.getType(), pack.size(), unpackedSize, 1);
+    }
+
+    sendPacket(pack, receiver, false);
 }
 
 void Transport::ban(const cs::PublicKey& key) {
@@ -189,49 +285,494 @@ void Transport::getBanList(BanList& ret_container) const {
 }
 
 void Transport::sendMulticast(Packet&& pack, const std::vector<cs::PublicKey>& receivers) {
-    for (auto& receiver : receivers) {
-        auto ptr = reinterpret_cast<const uint8_t*>(pack.data());
-        host_.SendDirect(toNodeId(receiver), cs::Bytes(ptr, ptr + pack.size()));
+    if (receivers.empty()) {
+        return;
+    }
+
+    ++multicasts_;
+
+    // receivers are grouped by pack method, receivers of a group share one packet
+    constexpr size_t kMethodsCount = PacketCompressor::kNewestMethod + 1;
+    std::array<std::vector<cs::PublicKey>, kMethodsCount> groups;
+
+    for (const auto& receiver : receivers) {
+        groups[getPackMethod(pack, receiver)].push_back(receiver);
+    }
+
+    const size_t unpackedSize = pack.size();
+    size_t lastGroup = groups.size() - 1;
+
+    while (groups[lastGroup].empty()) {
+        --lastGroup;
+    }
+
+    for (size_t method = 0; method <= lastGroup; ++method) {
+        const auto& group = groups[method];
+
+        if (group.empty()) {
+            continue;
+        }
+
+        Packet groupPack = method == lastGroup ? std::move(pack) : Packet(copyData(pack));
+        compressor_.pack(groupPack, static_cast<PacketCompressor::Method>(method));
+
+        if (!groupPack.isNetwork()) {
+            trafficStats_.onSent(groupPack.getType(), groupPack.size(), unpackedSize, group.size());
+        }
+
+        for (auto it = group.begin(); it != std::prev(group.end()); ++it) {
+            sendPacket(groupPack, *it, true);
+        }
+
+        sendPacket(groupPack, group.back(), false);
     }
 }
 
+// broadcast is counted once, host knows its receivers
 void Transport::sendBroadcast(Packet&& pack) {
+    if (!pack.isNetwork()) {
+        trafficStats_.onSent(pack.getType(), pack.size(), pack.size(), 1);
+    }
+
+    sendAllFrames();
     host_.SendBroadcast(pack.moveData());
 }
 
 void Transport::sendBroadcastIfNoConnection(Packet&& pack, const cs::PublicKey& receiver) {
+    if (!pack.isNetwork()) {
+        trafficStats_.onSent(pack.getType(), pack.size(), pack.size(), 1);
+    }
+
+    sendAllFrames();
     host_.SendBroadcastIfNoConnection(toNodeId(receiver), pack.moveData());
 }
 
-void Transport::processorRoutine() {
+void Transport::sendBroadcastIfNoConnection(Packet&& pack, const std::vector<cs::PublicKey>& receivers) {
+    if (receivers.empty()) {
+        return;
+    }
+
+    ++multicasts_;
+
+    if (!pack.isNetwork()) {
+        trafficStats_.onSent(pack.getType(), pack.size(), pack.size(), receivers.size());
+    }
+
+    sendAllFrames();
+
+    for (auto it = receivers.begin(); it != std::prev(receivers.end()); ++it) {
+        host_.SendBroadcastIfNoConnection(toNodeId(*it), copyData(pack));
+    }
+
+    host_.SendBroadcastIfNoConnection(toNodeId(receivers.back()), pack.moveData());
+}
+
+// host layer owns sent data, so the last receiver takes packet itself and others take its copies
+cs::Bytes Transport::copyData(const Packet& pack) {
+    ++copies_;
+    bytesCopied_ += pack.size();
+
+    auto ptr = reinterpret_cast<const uint8_t*>(pack.data());
+    return cs::Bytes(ptr, ptr + pack.size());
+}
+
+// broadcasts are relayed to nodes unknown to sender, so only direct packets are packed
+PacketCompressor::Method Transport::getPackMethod(const Packet& pack, const cs::PublicKey& receiver) const {
+    if (!pack.isCompressed() || pack.isNetwork()) {
+        return PacketCompressor::Method::None;
+    }
+
+    return PacketCompressor::getMethod(neighbourhood_.getPackMethod(receiver));
+}
+
+// small node messages wait in frames of their receivers, other node messages are sent after frame of receiver,
+// network messages are never framed, previous versions can not split frames
+void Transport::sendPacket(Packet& pack, const cs::PublicKey& receiver, bool copy) {
+    if (pack.isNetwork()) {
+        host_.SendDirect(toNodeId(receiver), copy ? copyData(pack) : pack.moveData());
+        return;
+    }
+
+    const bool coalescable = coalescer_.isCoalescable(pack) && neighbourhood_.canSplitFrames(receiver);
+
+    std::lock_guard lock(coalescerMux_);
+    const auto now = PacketCoalescer::Clock::now();
+
+    if (coalescable) {
+        if (coalescer_.add(receiver, pack, now, readyFrames_)) {
+            coalescerCondition_.notify_one();
+        }
+    }
+    else {
+        coalescer_.take(receiver, now, readyFrames_);
+    }
+
+    sendFrames();
+
+    if (!coalescable) {
+        host_.SendDirect(toNodeId(receiver), copy ? copyData(pack) : pack.moveData());
+    }
+}
+
+void Transport::sendFrames() {
+    for (auto& [receiver, data] : readyFrames_) {
+        host_.SendDirect(toNodeId(receiver), std::move(data));
+    }
+
+    readyFrames_.clear();
+}
+
+// broadcasts are not framed, so they follow messages which wait in frames
+void Transport::sendAllFrames() {
+    std::lock_guard lock(coalescerMux_);
+    coalescer_.takeAll(PacketCoalescer::Clock::now(), readyFrames_);
+    sendFrames();
+}
+
+void Transport::coalescerRoutine() {
     constexpr size_t kRoutineWaitTimeMs = 50;
+    std::unique_lock lock(coalescerMux_);
 
     while (!node_->isStopRequested()) {
-        process();
+        if (auto deadline = coalescer_.nextDeadline()) {
+            coalescerCondition_.wait_until(lock, *deadline);
+        }
+        else {
+            coalescerCondition_.wait_for(lock, std::chrono::milliseconds{kRoutineWaitTimeMs});
+        }
+
+        coalescer_.takeExpired(PacketCoalescer::Clock::now(), readyFrames_);
+        sendFrames();
+    }
+}
+
+TrafficStats::Counters Transport::getTrafficStats(MsgTypes type) const {
+    return trafficStats_.get(type);
+}
+
+void Transport::printTrafficStats() {
+    const auto period = std::chrono::seconds(cs::ConfigHolder::instance().config()->trafficStatsPeriod());
+    const auto now = std::chrono::steady_clock::now();
+
+    if (period.count() == 0 || now - trafficStatsPrinted_ < period) {
+        return;
+    }
+
+    trafficStatsPrinted_ = now;
+    trafficStats_.print();
+    printMetrics();
+}
+
+void Transport::printMetrics() const {
+    constexpr size_t kPrintedSendersCount = 3;
+    constexpr size_t kMsgTypesCount = 256;
+
+    for (size_t i = 0; i < kLanesCount; ++i) {
+        const auto lane = static_cast<Lane>(i);
+        const auto metrics = getLaneMetrics(lane);
+
+        cslog() << "Traffic> lane " << getLaneName(lane) << ": depth " << metrics.depth << " (" << WithDelimiters(metrics.bytes) << " bytes)"
+                << ", dropped " << metrics.dropped << ", throttled " << metrics.throttled
+                << ", handled " << metrics.handled << " in " << WithDelimiters(metrics.handlingTimeUs) << " us, max " << metrics.maxHandlingTimeUs << " us";
+
+        auto senders = getThrottledSenders(lane);
+        const size_t count = std::min(senders.size(), kPrintedSendersCount);
 
-        std::unique_lock lock(inboxMux_);
-        newPacketsReceived_.wait_for(lock, std::chrono::milliseconds{kRoutineWaitTimeMs}, [this]() {
-            return !inboxQueue_.empty();
+        std::partial_sort(senders.begin(), senders.begin() + static_cast<std::ptrdiff_t>(count), senders.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.throttledBytes > rhs.second.throttledBytes;
         });
 
-        while (!inboxQueue_.empty()) {
-            PacketsQueue::SenderAndPacket senderAndPack;
-            try {
-                senderAndPack = inboxQueue_.pop();
-            } catch (...) {
-              continue;
+        for (size_t j = 0; j < count; ++j) {
+            cslog() << "Traffic> lane " << getLaneName(lane) << " throttled " << cs::Utils::byteStreamToHex(senders[j].first)
+                    << ": " << senders[j].second.throttled << " packets (" << WithDelimiters(senders[j].second.throttledBytes) << " bytes)";
+        }
+    }
+
+    for (size_t i = 0; i < kMsgTypesCount; ++i) {
+        const auto type = static_cast<MsgTypes>(i);
+        const auto metrics = getCompressionMetrics(type);
+
+        if (metrics.packed == 0 && metrics.unpacked == 0) {
+            continue;
+        }
+
+        cslog() << "Traffic> packed " << Packet::messageTypeToString(type) << ": " << metrics.packed << " (ratio " << metrics.ratio()
+                << ", " << WithDelimiters(metrics.packTimeNs / 1000) << " us), unpacked " << metrics.unpacked
+                << " (" << WithDelimiters(metrics.unpackTimeNs / 1000) << " us)";
+    }
+
+    const auto coalescing = getCoalescingMetrics();
+    cslog() << "Traffic> coalescing: " << coalescing.frames << " frames of " << coalescing.framedMessages << " messages ("
+            << coalescing.messagesPerFrame() << " per frame), " << coalescing.singleMessages << " single"
+            << ", latency " << WithDelimiters(coalescing.latencyUs) << " us, max " << coalescing.maxLatencyUs << " us";
+
+    const auto send = getSendMetrics();
+    cslog() << "Traffic> multicasts " << send.multicasts << ", copies " << send.copies << " (" << WithDelimiters(send.bytesCopied) << " bytes)";
+
+    const auto duplicates = getDuplicateMetrics();
+    cslog() << "Traffic> duplicates dropped " << duplicates.dropped << ", " << duplicates.droppedInRound << " in round " << duplicates.round;
+
+    const auto postponed = getPostponedMetrics();
+    cslog() << "Traffic> postponed " << postponed.packets << " packets (" << WithDelimiters(postponed.bytes) << " bytes) of "
+            << postponed.rounds << " rounds, evicted " << postponed.evicted << ", rejected " << postponed.rejected;
+}
+
+Transport::DuplicateMetrics Transport::getDuplicateMetrics() const {
+    DuplicateMetrics metrics;
+    metrics.dropped = duplicatesDropped_;
+    metrics.round = lastDuplicatesRound_;
+    metrics.droppedInRound = lastRoundDuplicates_;
+
+    return metrics;
+}
+
+PacketCoalescer::Metrics Transport::getCoalescingMetrics() const {
+    std::lock_guard lock(coalescerMux_);
+    return coalescer_.getMetrics();
+}
+
+PacketCompressor::Metrics Transport::getCompressionMetrics(MsgTypes type) const {
+    return compressor_.getMetrics(type);
+}
+
+Transport::SendMetrics Transport::getSendMetrics() const {
+    SendMetrics metrics;
+    metrics.multicasts = multicasts_;
+    metrics.copies = copies_;
+    metrics.bytesCopied = bytesCopied_;
+
+    return metrics;
+}
+
+Transport::Lane Transport::getLane(MsgTypes type) {
+    switch (type) {
+        case MsgTypes::ThirdSmartStage:
+        case MsgTypes::Utility:
+        case MsgTypes::NodeStopRequest:
+        case MsgTypes::RoundTable:
+        case MsgTypes::BootstrapTable:
+        case MsgTypes::BlockHash:
+        case MsgTypes::FirstStage:
+        case MsgTypes::SecondStage:
+        case MsgTypes::FirstStageRequest:
+        case MsgTypes::SecondStageRequest:
+        case MsgTypes::ThirdStageRequest:
+        case MsgTypes::ThirdStage:
+        case MsgTypes::FirstSmartStage:
+        case MsgTypes::SecondSmartStage:
+        case MsgTypes::SmartFirstStageRequest:
+        case MsgTypes::SmartSecondStageRequest:
+        case MsgTypes::SmartThirdStageRequest:
+        case MsgTypes::RejectedContracts:
+        case MsgTypes::StateReply:
+        case MsgTypes::BlockAlarm:
+            return Lane::Consensus;
+        case MsgTypes::TransactionPacket:
+        case MsgTypes::TransactionsPacketReply:
+        case MsgTypes::TransactionsPacketRequest:
+            return Lane::Transactions;
+        case MsgTypes::BlockRequest:
+        case MsgTypes::RequestedBlock:
+            return Lane::Sync;
+        default:
+            return Lane::Misc;
+    }
+}
+
+const char* Transport::getLaneName(Lane lane) {
+    switch (lane) {
+        case Lane::Consensus:
+            return "consensus";
+        case Lane::Transactions:
+            return "transactions";
+        case Lane::Sync:
+            return "sync";
+        default:
+            return "misc";
+    }
+}
+
+Transport::LaneMetrics Transport::getLaneMetrics(Lane lane) const {
+    const auto& data = lanes_[static_cast<size_t>(lane)];
+
+    LaneMetrics metrics;
+    metrics.depth = data.queue.size();
+    metrics.bytes = data.queue.bytes();
+    metrics.dropped = data.queue.dropped();
+    metrics.throttled = data.limiter.throttled();
+    metrics.handled = data.handled;
+    metrics.handlingTimeUs = data.handlingTimeUs;
+    metrics.maxHandlingTimeUs = data.maxHandlingTimeUs;
+
+    return metrics;
+}
+
+std::vector<SenderLimiter::SenderCounters> Transport::getThrottledSenders(Lane lane) const {
+    return lanes_[static_cast<size_t>(lane)].limiter.getThrottledSenders();
+}
+
+void Transport::laneRoutine(Lane lane) {
+    constexpr size_t kRoutineWaitTimeMs = 50;
+    auto& data = lanes_[static_cast<size_t>(lane)];
+
+    PacketsQueue::SenderAndPacket senderAndPack;
+
+    while (!node_->isStopRequested()) {
+        {
+            std::unique_lock lock(data.mux);
+            data.packetsReceived.wait_for(lock, std::chrono::milliseconds{kRoutineWaitTimeMs}, [&data]() {
+                return !data.queue.empty();
+            });
+        }
+
+        if (data.queue.empty()) {
+            // the consensus lane keeps calls queue running while there are no messages
+            if (lane == Lane::Consensus) {
+                beginDispatch(lane);
+                process();
+                endDispatch();
             }
 
-            lock.unlock();
+            continue;
+        }
+
+        while (!node_->isStopRequested() && data.queue.pop(senderAndPack)) {
+            // unpacked before dispatch, so lanes do not wait for each other
+            if (!compressor_.unpack(senderAndPack.second)) {
+                cswarning() << "Transport> can not unpack " << Packet::messageTypeToString(senderAndPack.second.getType())
+                            << " from " << cs::Utils::byteStreamToHex(senderAndPack.first);
+                continue;
+            }
 
-            process();
-            processNodeMessage(senderAndPack.first, senderAndPack.second);
+            if (lane == Lane::Transactions && isDuplicate(senderAndPack.second)) {
+                trafficStats_.onDuplicate(senderAndPack.second.getType());
+                continue;
+            }
 
-            lock.lock();
+            handleLanePacket(lane, senderAndPack);
         }
     }
 }
 
+bool Transport::isDuplicate(const Packet& pack) {
+    if (pack.getType() != MsgTypes::TransactionPacket || !duplicateFilter_.isEnabled()) {
+        return false;
+    }
+
+    const auto round = cs::Conveyer::instance().currentRoundNumber();
+
+    if (round != duplicateFilterRound_) {
+        if (duplicatesInRound_) {
+            csdebug() << "Transport> " << duplicatesInRound_ << " duplicate transaction packets dropped in round " << duplicateFilterRound_;
+        }
+
+        lastDuplicatesRound_ = duplicateFilterRound_;
+        lastRoundDuplicates_ = duplicatesInRound_;
+
+        duplicateFilterRound_ = round;
+        duplicatesInRound_ = 0;
+        duplicateFilter_.rotate();
+    }
+
+    // relays may send a packet with own round in header, so only the payload is a key
+    if (!duplicateFilter_.testAndAdd(DuplicateFilter::getKey(pack.getMsgData(), pack.getMsgSize()))) {
+        return false;
+    }
+
+    ++duplicatesInRound_;
+    ++duplicatesDropped_;
+    return true;
+}
+
+void Transport::handleLanePacket(Lane lane, PacketsQueue::SenderAndPacket& senderAndPack) {
+    auto& data = lanes_[static_cast<size_t>(lane)];
+    const auto type = senderAndPack.second.getType();
+
+    std::chrono::steady_clock::duration duration;
+
+    if (type == MsgTypes::BlockRequest || type == MsgTypes::RequestedBlock) {
+        duration = handleSyncPacket(senderAndPack.first, std::move(senderAndPack.second));
+    }
+    else {
+        beginDispatch(lane);
+        process();
+
+        const auto start = std::chrono::steady_clock::now();
+        processNodeMessage(senderAndPack.first, std::move(senderAndPack.second));
+        duration = std::chrono::steady_clock::now() - start;
+
+        endDispatch();
+    }
+
+    const uint64_t durationUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+
+    ++data.handled;
+    data.handlingTimeUs += durationUs;
+    trafficStats_.onHandled(type, durationUs);
+
+    // only the lane worker updates its metrics
+    if (durationUs > data.maxHandlingTimeUs) {
+        data.maxHandlingTimeUs = durationUs;
+    }
+}
+
+std::chrono::steady_clock::duration Transport::handleSyncPacket(const cs::PublicKey& sender, Packet&& pack) {
+    const auto type = pack.getType();
+    auto start = std::chrono::steady_clock::now();
+
+    // sync messages are never postponed
+    if (node_->chooseMessageAction(pack.getRoundNum(), type, sender) != Node::MessageActions::Process) {
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    if (type == MsgTypes::BlockRequest) {
+        node_->getBlockRequest(pack.getMsgData(), pack.getMsgSize(), sender);
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    auto syncedBlocks = node_->prepareBlockReply(pack.getMsgData(), pack.getMsgSize());
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    beginDispatch(Lane::Sync);
+    process();
+
+    start = std::chrono::steady_clock::now();
+    node_->getBlockReply(std::move(syncedBlocks), sender);
+    duration += std::chrono::steady_clock::now() - start;
+
+    endDispatch();
+
+    return duration;
+}
+
+void Transport::beginDispatch(Lane lane) {
+    const bool consensus = lane == Lane::Consensus;
+    std::unique_lock lock(dispatchMux_);
+
+    if (consensus) {
+        ++consensusWaiting_;
+    }
+
+    dispatchCondition_.wait(lock, [this, consensus]() {
+        return !dispatching_ && (consensus || consensusWaiting_ == 0);
+    });
+
+    if (consensus) {
+        --consensusWaiting_;
+    }
+
+    dispatching_ = true;
+}
+
+void Transport::endDispatch() {
+    {
+        std::lock_guard lock(dispatchMux_);
+        dispatching_ = false;
+    }
+
+    dispatchCondition_.notify_all();
+}
+
 void Transport::process() {
     checkNeighboursChange();
     CallsQueue::instance().callAll();
@@ -251,7 +792,7 @@ void Transport::checkNeighboursChange() {
     }
 }
 
-void Transport::processNodeMessage(const cs::PublicKey& sender, const Packet& pack) {
+void Transport::processNodeMessage(const cs::PublicKey& sender, Packet&& pack) {
     auto type = pack.getType();
     auto rNum = pack.getRoundNum();
 
@@ -259,7 +800,7 @@ void Transport::processNodeMessage(const cs::PublicKey& sender, const Packet& pa
         case Node::MessageActions::Process:
             return dispatchNodeMessage(sender, type, rNum, pack.getMsgData(), pack.getMsgSize());
         case Node::MessageActions::Postpone:
-            return postponePacket(sender, rNum, pack);
+            return postponePacket(sender, rNum, std::move(pack));
         case Node::MessageActions::Drop:
             return;
     }
@@ -280,7 +821,7 @@ void Transport::dispatchNodeMessage(const cs::PublicKey& sender, const MsgTypes
         case MsgTypes::BlockRequest:
             return node_->getBlockRequest(data, size, sender);
         case MsgTypes::RequestedBlock:
-            return node_->getBlockReply(data, size);
+            return node_->getBlockReply(data, size, sender);
         case MsgTypes::Utility:
             return node_->getUtilityMessage(data, size);
         case MsgTypes::NodeStopRequest:
@@ -346,20 +887,40 @@ void Transport::dispatchNodeMessage(const cs::PublicKey& sender, const MsgTypes
     }
 }
 
-inline void Transport::postponePacket(const cs::PublicKey& sender, const cs::RoundNumber rNum, const Packet& pack) {
-    postponed_[rNum].push_back(PostponedPack{sender, pack});
+inline void Transport::postponePacket(const cs::PublicKey& sender, const cs::RoundNumber rNum, Packet&& pack) {
+    bool added = false;
+
+    {
+        std::lock_guard lock(postponedMux_);
+        added = postponed_.add(sender, rNum, std::move(pack));
+    }
+
+    if (!added) {
+        csdebug() << "TRANSPORT> postponed packet of round " << rNum << " from " << cs::Utils::byteStreamToHex(sender) << " is rejected";
+    }
 }
 
 void Transport::processPostponed(const cs::RoundNumber rNum) {
-    auto& packs = postponed_[rNum];
+    // packets are taken out before dispatch, handlers may get here again for the next round
+    PostponedStore::Packs packs;
+
+    {
+        std::lock_guard lock(postponedMux_);
+        packs = postponed_.take(rNum);
+    }
+
     for (auto& p: packs) {
         dispatchNodeMessage(p.sender, p.pack.getType(), rNum, p.pack.getMsgData(), p.pack.getMsgSize());
     }
 
-    postponed_.erase(postponed_.begin(), postponed_.upper_bound(rNum));
     csdebug() << "TRANSPORT> POSTPHONED finished, round " << rNum;
 }
 
+PostponedStore::Metrics Transport::getPostponedMetrics() const {
+    std::lock_guard lock(postponedMux_);
+    return postponed_.getMetrics();
+}
+
 void Transport::setPermanentNeighbours(const std::set<cs::PublicKey>& neighbours) {
     neighbourhood_.setPermanentNeighbours(neighbours);
 }
@@ -395,6 +956,14 @@ void Transport::getKnownPeers(std::vector<cs::PeerData>& result) {
     }
 }
 
+std::vector<cs::PublicKey> Transport::getBestNeighbours(size_t count) const {
+    return neighbourhood_.getBestNeighbours(count);
+}
+
+PeerQuality Transport::getPeerQuality(const cs::PublicKey& key) const {
+    return neighbourhood_.getQuality(key);
+}
+
 void Transport::addToNeighbours(const std::set<cs::PublicKey>& keys) {
     neighbourhood_.add(keys);
 }
@@ -1025,7 +1025,7 @@ Reject::Reason SmartContracts::prevalidate(const BlockChain& bc, const cs::Trans
     size_t i = 0;
     size_t total_size = 0;
     for (const auto& t : pack.transactions()) {
-        const auto size = t.to_byte_stream().size();
+        const auto size = t.byte_stream_size();
         if (size > Consensus::MaxTransactionSize) {
             csdebug() << kLogPrefix << "exceeded max transaction size, prevalidation failed";
             return Reject::Reason::LimitExceeded;
@@ -2270,7 +2270,7 @@ bool SmartContracts::start_consensus(QueueItem& item) {
                 for (const auto& t : e.result.transactions()) {
                     integral_packet.addTransaction(t);
                     ++total_cnt;
-                    total_size += t.to_byte_stream().size();
+                    total_size += t.byte_stream_size();
                 }
             }
         }
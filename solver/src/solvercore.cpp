@@ -470,8 +470,7 @@ void SolverCore::spawn_next_round(const cs::PublicKeys& nodes, const cs::Packets
         return;
     }
 
-    cs::Bytes bytes = justCreatedRoundPackage.bytesToSign();
-    stage3.roundHash = cscrypto::calculateHash(bytes.data(), bytes.size());
+    stage3.roundHash = justCreatedRoundPackage.hashToSign();
 
     cs::Bytes messageToSign;
     messageToSign.reserve(sizeof(cs::RoundNumber) + sizeof(uint8_t) + sizeof(cs::Hash));
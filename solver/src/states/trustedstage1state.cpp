@@ -145,7 +145,7 @@ Result TrustedStage1State::onSyncTransactions(SolverContext& context, cs::RoundN
         bool continueFlag = false;
         size_t tSize = 0;
         for (const auto& element : conveyer.transactionsPacketTable()) {
-            if (conveyer.currentRoundNumber() + 2 >= element.second.expiredRound()) {
+            if (conveyer.currentRoundNumber() + 2 >= element.second->expiredRound()) {
                 continue;
             }
 
@@ -157,14 +157,14 @@ Result TrustedStage1State::onSyncTransactions(SolverContext& context, cs::RoundN
                     finishFlag = true;
                 }
 
-                trxCounter += element.second.transactionsCount();
+                trxCounter += element.second->transactionsCount();
                 if (trxCounter > Consensus::MaxStageOneTransactions) {
                     finishFlag = true;
                 }
 
                 deltaBlockSize = 0;
-                for (auto& it : element.second.transactions()) {
-                    tSize = it.to_byte_stream().size();
+                for (auto& it : element.second->transactions()) {
+                    tSize = it.byte_stream_size();
                     deltaBlockSize += tSize;
                     preliminaryBlockSize += tSize;
                     csdetails() << name() << ": include transaction " << tSize << " bytes";
@@ -178,12 +178,12 @@ Result TrustedStage1State::onSyncTransactions(SolverContext& context, cs::RoundN
                 }
 
                 if (finishFlag) {
-                    trxCounter -= element.second.transactionsCount();
+                    trxCounter -= element.second->transactionsCount();
                     preliminaryBlockSize -= deltaBlockSize;
                     break;
                 }
                 if (continueFlag) {
-                    trxCounter -= element.second.transactionsCount();
+                    trxCounter -= element.second->transactionsCount();
                     preliminaryBlockSize -= deltaBlockSize;
                     continue;
                 }
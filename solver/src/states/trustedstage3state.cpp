@@ -4,6 +4,7 @@
 #include <csnode/blockchain.hpp>
 #include <csnode/conveyer.hpp>
 #include <csnode/datastream.hpp>
+#include <csnode/signatureverifier.hpp>
 
 #include <lib/system/utils.hpp>
 #include <lib/system/random.hpp>
@@ -186,6 +187,29 @@ Result TrustedStage3State::onStage2(SolverContext& context, const cs::StageTwo&)
     if (ptr != nullptr && cnt_recv_stages == context.cnt_trusted()) {
         csdebug() << name() << ": enough stage-2 received";
         const size_t cnt = context.cnt_trusted();
+
+        // signatures of disputed hashes are verified by single batch before analysis
+        cs::SignatureVerifier::Batch batch;
+        for (auto& it : context.stage2_data()) {
+            if (it.sender == context.own_conf_number()) {
+                continue;
+            }
+            for (size_t j = 0; j < cnt; j++) {
+                if (ptr->signatures[j] == it.signatures[j] || it.hashes[j] == Zero::hash) {
+                    continue;
+                }
+                cs::Bytes toVerify;
+                size_t messageSize = sizeof(cs::RoundNumber) + sizeof(uint8_t) + sizeof(cs::Hash);
+                toVerify.reserve(messageSize);
+                cs::ODataStream stream(toVerify);
+                stream << cs::Conveyer::instance().currentRoundNumber() << context.subRound();  // Attention!!! the uint32_t type
+                stream << it.hashes[j];
+                batch.push_back(cs::SignatureVerifier::Entry{std::make_shared<const cs::Bytes>(std::move(toVerify)), context.trusted().at(it.sender), it.signatures[j]});
+            }
+        }
+        const auto verified = cs::SignatureVerifier::verify(batch);
+        size_t verifiedIndex = 0;
+
         for (auto& it : context.stage2_data()) {
             if (it.sender != context.own_conf_number()) {
                 csdebug() << "Comparing with T(" << static_cast<int>(ptr->sender) << "):";
@@ -202,14 +226,7 @@ Result TrustedStage3State::onStage2(SolverContext& context, const cs::StageTwo&)
                             continue;
                         }
 
-                        cs::Bytes toVerify;
-                        size_t messageSize = sizeof(cs::RoundNumber) + sizeof(uint8_t) + sizeof(cs::Hash);
-                        toVerify.reserve(messageSize);
-                        cs::ODataStream stream(toVerify);
-                        stream << cs::Conveyer::instance().currentRoundNumber() << context.subRound();  // Attention!!! the uint32_t type
-                        stream << it.hashes[j];
-
-                        if (cscrypto::verifySignature(it.signatures[j], context.trusted().at(it.sender), toVerify.data(), messageSize)) {
+                        if (verified[verifiedIndex++]) {
                             cslog() << name() << ": [" << static_cast<int>(j) << "] marked as untrusted (sent bad hash-signature pair of [" << static_cast<int>(it.sender) << "])";
                             context.mark_untrusted(static_cast<uint8_t>(j));
                         }
@@ -0,0 +1,61 @@
+#include <csnode/blockreplycache.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+cs::CompressedRegion makeRegion(size_t size) {
+    return cs::CompressedRegion(cs::Bytes(size, 1), size);
+}
+}  // namespace
+
+TEST(BlockReplyCache, ServesInsertedReply) {
+    cs::BlockReplyCache cache;
+    const cs::PoolsRequestedSequences sequences{1, 2, 3};
+
+    ASSERT_EQ(cache.find(sequences), nullptr);
+
+    cache.insert(sequences, makeRegion(100), std::chrono::milliseconds(5), cache.generation());
+    auto region = cache.find(sequences);
+
+    ASSERT_NE(region, nullptr);
+    ASSERT_EQ(region->size(), 100u);
+    ASSERT_EQ(cache.find(cs::PoolsRequestedSequences{1, 2}), nullptr);
+
+    ASSERT_EQ(cache.hits(), 1u);
+    ASSERT_EQ(cache.misses(), 2u);
+    ASSERT_EQ(cache.savedTime(), std::chrono::milliseconds(5));
+}
+
+TEST(BlockReplyCache, EvictsLeastRecentlyUsed) {
+    cs::BlockReplyCache cache(250);
+    const cs::PoolsRequestedSequences first{1};
+    const cs::PoolsRequestedSequences second{2};
+    const cs::PoolsRequestedSequences third{3};
+
+    cache.insert(first, makeRegion(100), {}, cache.generation());
+    cache.insert(second, makeRegion(100), {}, cache.generation());
+    ASSERT_NE(cache.find(first), nullptr);
+
+    cache.insert(third, makeRegion(100), {}, cache.generation());
+
+    ASSERT_NE(cache.find(first), nullptr);
+    ASSERT_EQ(cache.find(second), nullptr);
+    ASSERT_NE(cache.find(third), nullptr);
+    ASSERT_EQ(cache.bytes(), 200u);
+}
+
+TEST(BlockReplyCache, DropsRepliesOnRemovedBlock) {
+    cs::BlockReplyCache cache;
+    const cs::PoolsRequestedSequences sequences{1, 2};
+
+    const auto generation = cache.generation();
+    cache.insert(sequences, makeRegion(10), {}, generation);
+    cache.onRemoveBlock(csdb::Pool{});
+
+    ASSERT_EQ(cache.find(sequences), nullptr);
+    ASSERT_EQ(cache.bytes(), 0u);
+
+    // reply built before removal is not cached
+    cache.insert(sequences, makeRegion(10), {}, generation);
+    ASSERT_EQ(cache.find(sequences), nullptr);
+}
@@ -197,7 +197,7 @@ TEST(Conveyer, CanSuccessfullyAddTransactionsPacket) {
     auto packet = CreateTestPacket(2);
     conveyer.addTransactionsPacket(packet);
     auto& table{conveyer.transactionsPacketTable()};
-    ASSERT_EQ(table.at(packet.hash()).toBinary(cs::TransactionsPacket::Serialization::Transactions), packet.toBinary(cs::TransactionsPacket::Serialization::Transactions));
+    ASSERT_EQ(table.at(packet.hash())->toBinary(cs::TransactionsPacket::Serialization::Transactions), packet.toBinary(cs::TransactionsPacket::Serialization::Transactions));
 }
 
 TEST(Conveyer, CanAddTransactionToLastBlock) {
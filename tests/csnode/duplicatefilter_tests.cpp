@@ -0,0 +1,61 @@
+#define TESTING
+
+#include <duplicatefilter.hpp>
+
+#include "gtest/gtest.h"
+
+TEST(DuplicateFilter, SizesFilterByFalsePositiveRate) {
+    DuplicateFilter filter(1000, 0.01);
+
+    ASSERT_TRUE(filter.isEnabled());
+    ASSERT_EQ(filter.hashesCount(), 7u);
+    ASSERT_GE(filter.bitsCount(), 9586u);
+    ASSERT_EQ(filter.bitsCount() % 64, 0u);
+
+    DuplicateFilter disabled(1000, 0.0);
+
+    ASSERT_FALSE(disabled.isEnabled());
+    ASSERT_FALSE(disabled.testAndAdd(1));
+    ASSERT_FALSE(disabled.testAndAdd(1));
+}
+
+TEST(DuplicateFilter, RemembersKeysForTwoGenerations) {
+    const uint8_t payload[] = {1, 2, 3, 4, 5};
+    const auto key = DuplicateFilter::getKey(payload, sizeof(payload));
+
+    DuplicateFilter filter;
+
+    ASSERT_FALSE(filter.testAndAdd(key));
+    ASSERT_TRUE(filter.testAndAdd(key));
+
+    filter.rotate();
+    ASSERT_TRUE(filter.testAndAdd(key));
+
+    filter.rotate();
+    ASSERT_FALSE(filter.testAndAdd(key));
+}
+
+TEST(DuplicateFilter, KeepsFalsePositiveRate) {
+    constexpr size_t kCapacity = 10'000;
+    constexpr double kRate = 0.01;
+
+    DuplicateFilter filter(kCapacity, kRate);
+
+    for (uint64_t i = 0; i < kCapacity; ++i) {
+        filter.testAndAdd(DuplicateFilter::getKey(reinterpret_cast<const uint8_t*>(&i), sizeof(i)));
+    }
+
+    size_t falsePositives = 0;
+
+    for (uint64_t i = kCapacity; i < kCapacity * 2; ++i) {
+        const auto key = DuplicateFilter::getKey(reinterpret_cast<const uint8_t*>(&i), sizeof(i));
+        falsePositives += filter.testAndAdd(key) ? 1 : 0;
+
+        // the filter rotates by itself when full, keys of the last generation stay
+        if (i == kCapacity) {
+            ASSERT_TRUE(filter.testAndAdd(key));
+        }
+    }
+
+    ASSERT_LT(falsePositives, static_cast<size_t>(kCapacity * kRate * 3));
+}
@@ -37,7 +37,7 @@ public:
 
   /*syncro get functions*/
   MOCK_METHOD3(getBlockRequest, void(const uint8_t*, const size_t, const cs::PublicKey& sender));
-  MOCK_METHOD2(getBlockReply, void(const uint8_t*, const size_t));
+  MOCK_METHOD3(getBlockReply, void(const uint8_t*, const size_t, const cs::PublicKey&));
   MOCK_METHOD3(getWritingConfirmation, void(const uint8_t* data, const size_t size, const cs::PublicKey& sender));
 
   /* Outcoming requests forming */
@@ -54,7 +54,7 @@ public:
   MOCK_METHOD2(sendPacketHashesRequest, void(const cs::PacketsHashes& hashes, const cs::RoundNumber round));
   MOCK_METHOD2(sendPacketHashesRequestToNeighbours, void(const cs::PacketsHashes& hashes, const cs::RoundNumber round));
   MOCK_METHOD3(sendPacketHashesReply,
-               void(const cs::PacketsVector& packet, const cs::RoundNumber round, const cs::PublicKey& sender));
+               void(const cs::SharedPacketsVector& packet, const cs::RoundNumber round, const cs::PublicKey& sender));
 
   MOCK_METHOD3(sendCharacteristic, void(const csdb::Pool& emptyMetaPool, const uint32_t maskBitsCount,
                                         const std::vector<uint8_t>& characteristic));
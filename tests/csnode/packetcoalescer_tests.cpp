@@ -0,0 +1,153 @@
+#define TESTING
+
+#include <chrono>
+#include <vector>
+
+#include <packetcoalescer.hpp>
+
+#include "gtest/gtest.h"
+
+#include "packetshelper.hpp"
+
+namespace {
+cs::Bytes packetBytes(const Packet& packet) {
+    auto data = static_cast<const cs::Byte*>(packet.data());
+    return cs::Bytes(data, data + packet.size());
+}
+}  // namespace
+
+TEST(PacketCoalescer, CoalescesMessagesOfReceiver) {
+    PacketCoalescer coalescer;
+    PacketCoalescer::Frames ready;
+
+    const auto first = makeKey(1);
+    const auto second = makeKey(2);
+    const auto now = PacketCoalescer::Clock::now();
+
+    std::vector<Packet> packets = {makePacket(MsgTypes::FirstStage, 10, 1), makePacket(MsgTypes::SecondStage, 20, 2),
+                                   makePacket(MsgTypes::BlockHash, 30, 3)};
+
+    ASSERT_TRUE(coalescer.add(first, packets[0], now, ready));
+    ASSERT_FALSE(coalescer.add(first, packets[1], now, ready));
+    ASSERT_FALSE(coalescer.add(first, packets[2], now, ready));
+    ASSERT_TRUE(coalescer.add(second, packets[0], now, ready));
+
+    ASSERT_EQ(coalescer.nextDeadline(), now + PacketCoalescer::Settings{}.latency);
+
+    coalescer.takeExpired(now, ready);
+    ASSERT_TRUE(ready.empty());
+
+    coalescer.takeExpired(now + PacketCoalescer::Settings{}.latency, ready);
+    ASSERT_EQ(ready.size(), 2u);
+    ASSERT_TRUE(coalescer.empty());
+
+    for (auto& [receiver, data] : ready) {
+        Packet pack(std::move(data));
+
+        if (receiver == second) {
+            ASSERT_EQ(packetBytes(pack), packetBytes(packets[0]));
+            continue;
+        }
+
+        std::vector<Packet> split;
+        ASSERT_TRUE(PacketCoalescer::isFrame(pack));
+        ASSERT_TRUE(PacketCoalescer::split(pack, split));
+        ASSERT_EQ(split.size(), packets.size());
+
+        for (size_t i = 0; i < split.size(); ++i) {
+            ASSERT_EQ(packetBytes(split[i]), packetBytes(packets[i]));
+        }
+    }
+
+    const auto& metrics = coalescer.getMetrics();
+    ASSERT_EQ(metrics.frames, 1u);
+    ASSERT_EQ(metrics.framedMessages, 3u);
+    ASSERT_EQ(metrics.singleMessages, 1u);
+    ASSERT_EQ(metrics.maxLatencyUs, 1000u);
+}
+
+TEST(PacketCoalescer, TakesFullFrame) {
+    PacketCoalescer::Settings settings;
+    settings.maxFrameSize = 256;
+
+    PacketCoalescer coalescer(settings);
+    PacketCoalescer::Frames ready;
+
+    const auto key = makeKey(1);
+    const auto now = PacketCoalescer::Clock::now();
+
+    for (size_t i = 0; i < 4; ++i) {
+        coalescer.add(key, makePacket(MsgTypes::FirstStage, 100, 1), now, ready);
+    }
+
+    // the third message does not fit the frame of two
+    ASSERT_EQ(ready.size(), 1u);
+    ASSERT_LE(ready.front().second.size(), settings.maxFrameSize);
+
+    coalescer.take(key, now, ready);
+    ASSERT_EQ(ready.size(), 2u);
+    ASSERT_EQ(coalescer.getMetrics().framedMessages, 4u);
+}
+
+TEST(PacketCoalescer, RejectsMalformedFrame) {
+    PacketCoalescer coalescer;
+    PacketCoalescer::Frames ready;
+
+    const auto key = makeKey(1);
+    const auto now = PacketCoalescer::Clock::now();
+
+    ASSERT_FALSE(coalescer.isCoalescable(makePacket(MsgTypes::RoundTable, PacketCoalescer::Settings{}.maxMessageSize, 1)));
+
+    coalescer.add(key, makePacket(MsgTypes::FirstStage, 10, 1), now, ready);
+    coalescer.add(key, makePacket(MsgTypes::FirstStage, 10, 1), now, ready);
+    coalescer.take(key, now, ready);
+
+    ASSERT_EQ(ready.size(), 1u);
+
+    auto bytes = ready.front().second;
+    bytes.pop_back();
+
+    std::vector<Packet> packets;
+    ASSERT_FALSE(PacketCoalescer::split(Packet(std::move(bytes)), packets));
+
+    // a frame inside a frame
+    cs::Bytes nested = {BaseFlags::NetworkMsg, static_cast<cs::Byte>(NetworkCommand::Frame)};
+    const auto& inner = ready.front().second;
+    const auto size = static_cast<uint32_t>(inner.size());
+    auto sizeData = reinterpret_cast<const cs::Byte*>(&size);
+
+    nested.insert(nested.end(), sizeData, sizeData + sizeof(size));
+    nested.insert(nested.end(), inner.begin(), inner.end());
+
+    packets.clear();
+    ASSERT_FALSE(PacketCoalescer::split(Packet(std::move(nested)), packets));
+}
+
+TEST(PacketCoalescer, ErasesTakenFrames) {
+    PacketCoalescer::Settings settings;
+    settings.maxFrameSize = 256;
+
+    PacketCoalescer coalescer(settings);
+    PacketCoalescer::Frames ready;
+
+    const auto now = PacketCoalescer::Clock::now();
+    const auto pack = makePacket(MsgTypes::FirstStage, 100, 1);
+
+    for (cs::Byte i = 0; i < 3; ++i) {
+        coalescer.add(makeKey(i), pack, now, ready);
+    }
+
+    ASSERT_EQ(coalescer.receivers(), 3u);
+
+    coalescer.take(makeKey(0), now, ready);
+    ASSERT_EQ(coalescer.receivers(), 2u);
+
+    coalescer.takeExpired(now + settings.latency, ready);
+    ASSERT_EQ(coalescer.receivers(), 0u);
+
+    // full frame is taken and erased by add itself
+    coalescer.add(makeKey(3), makePacket(MsgTypes::FirstStage, settings.maxFrameSize, 1), now, ready);
+    ASSERT_EQ(coalescer.receivers(), 0u);
+    ASSERT_TRUE(coalescer.empty());
+    ASSERT_EQ(ready.size(), 4u);
+}
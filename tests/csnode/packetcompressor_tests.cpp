@@ -0,0 +1,131 @@
+#define TESTING
+
+#include <cstring>
+
+#include <packetcompressor.hpp>
+
+#include <lib/system/random.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+const cs::Bytes kCommonSegment = {'t', 'r', 'a', 'n', 's', 'a', 'c', 't', 'i', 'o', 'n', ' ', 's', 'h', 'a', 'r', 'e', 'd', ' ', 'b',
+                                  'y', ' ', 'a', 'l', 'l', ' ', 'm', 'e', 's', 's', 'a', 'g', 'e', 's', ' ', 'o', 'f', ' ', 'i', 't'};
+
+cs::Bytes randomBytes(size_t size) {
+    cs::Bytes bytes(size);
+
+    for (auto& byte : bytes) {
+        byte = cs::Random::generateValue<cs::Byte>(0, 255);
+    }
+
+    return bytes;
+}
+
+// random bytes around common segment
+cs::Bytes makeMessage() {
+    auto message = randomBytes(16);
+    message.insert(message.end(), kCommonSegment.begin(), kCommonSegment.end());
+
+    const auto tail = randomBytes(16);
+    message.insert(message.end(), tail.begin(), tail.end());
+
+    return message;
+}
+
+Packet makePacket(MsgTypes type, const cs::Bytes& payload) {
+    cs::Bytes bytes(static_cast<size_t>(Offsets::HeaderLength));
+    bytes[0] = BaseFlags::Compressed;
+    bytes[1] = type;
+
+    bytes.insert(bytes.end(), payload.begin(), payload.end());
+    return Packet(std::move(bytes));
+}
+
+cs::Bytes packetBytes(const Packet& packet) {
+    auto data = static_cast<const cs::Byte*>(packet.data());
+    return cs::Bytes(data, data + packet.size());
+}
+}  // namespace
+
+TEST(PacketCompressor, SelectsMethodByPeerAnnouncement) {
+    const auto newer = static_cast<PacketCompressor::Method>(PacketCompressor::kNewestMethod + 1);
+
+    ASSERT_EQ(PacketCompressor::getMethod(PacketCompressor::Method::None), PacketCompressor::Method::None);
+    ASSERT_EQ(PacketCompressor::getMethod(PacketCompressor::Method::Lz4), PacketCompressor::Method::Lz4);
+    ASSERT_EQ(PacketCompressor::getMethod(newer), PacketCompressor::kNewestMethod);
+}
+
+TEST(PacketCompressor, UnpacksPackedPacket) {
+    PacketCompressor compressor;
+
+    cs::Bytes payload;
+
+    for (size_t i = 0; i < 10; ++i) {
+        const auto message = makeMessage();
+        payload.insert(payload.end(), message.begin(), message.end());
+    }
+
+    const auto origin = makePacket(MsgTypes::TransactionPacket, payload);
+    auto packet = origin;
+
+    ASSERT_TRUE(compressor.pack(packet, PacketCompressor::Method::Lz4));
+    ASSERT_TRUE(packet.isPacked());
+    ASSERT_LT(packet.size(), origin.size());
+    ASSERT_EQ(packet.getType(), MsgTypes::TransactionPacket);
+
+    ASSERT_TRUE(compressor.unpack(packet));
+    ASSERT_FALSE(packet.isPacked());
+    ASSERT_EQ(packetBytes(packet), packetBytes(origin));
+
+    ASSERT_EQ(compressor.getMetrics(MsgTypes::TransactionPacket).packed, 1u);
+    ASSERT_EQ(compressor.getMetrics(MsgTypes::TransactionPacket).unpacked, 1u);
+}
+
+TEST(PacketCompressor, LeavesPacketIfNotSmaller) {
+    PacketCompressor compressor;
+
+    auto small = makePacket(MsgTypes::TransactionPacket, cs::Bytes(PacketCompressor::kMinPayloadSize - 1, 0));
+    auto random = makePacket(MsgTypes::TransactionPacket, randomBytes(1024));
+    auto block = makePacket(MsgTypes::RequestedBlock, cs::Bytes(1024, 0));
+
+    ASSERT_FALSE(compressor.pack(small, PacketCompressor::Method::Lz4));
+    ASSERT_FALSE(compressor.pack(random, PacketCompressor::Method::Lz4));
+    ASSERT_FALSE(compressor.pack(block, PacketCompressor::Method::Lz4));
+    ASSERT_FALSE(block.isPacked());
+}
+
+TEST(PacketCompressor, RejectsCorruptedPacket) {
+    PacketCompressor compressor;
+
+    auto packet = makePacket(MsgTypes::TransactionPacket, cs::Bytes(1024, 1));
+    ASSERT_TRUE(compressor.pack(packet, PacketCompressor::Method::Lz4));
+
+    auto bytes = packetBytes(packet);
+    const uint32_t size = 2048;
+    std::memcpy(bytes.data() + packet.getHeadersLength() + sizeof(PacketCompressor::Method), &size, sizeof(size));
+
+    Packet corrupted(std::move(bytes));
+    ASSERT_FALSE(compressor.unpack(corrupted));
+}
+
+TEST(PacketCompressor, RejectsOriginalSizeBeyondRatio) {
+    PacketCompressor compressor;
+
+    const cs::Bytes payload(1ul << 20, 0);
+    const auto origin = makePacket(MsgTypes::TransactionPacket, payload);
+
+    auto packet = origin;
+    ASSERT_TRUE(compressor.pack(packet, PacketCompressor::Method::Lz4));
+
+    auto bytes = packetBytes(packet);
+    ASSERT_TRUE(compressor.unpack(packet));
+    ASSERT_EQ(packetBytes(packet), packetBytes(origin));
+
+    const size_t packedSize = bytes.size() - packet.getHeadersLength() - PacketCompressor::kHeaderSize;
+    const auto size = static_cast<uint32_t>(packedSize * PacketCompressor::kMaxRatio + 1);
+    std::memcpy(bytes.data() + packet.getHeadersLength() + sizeof(PacketCompressor::Method), &size, sizeof(size));
+
+    Packet claimed(std::move(bytes));
+    ASSERT_FALSE(compressor.unpack(claimed));
+}
@@ -1,6 +1,10 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include <csnode/packetqueue.hpp>
 
+#include <csdb/currency.hpp>
+
 const size_t kMaxPacketTransactions = 100;
 const size_t kMaxPacketsPerRound = 10;
 const size_t kMaxQueueSize = 100;
@@ -58,3 +62,78 @@ TEST(PacketQueue, popTransactionsBlocks) {
 
     ASSERT_EQ(queue.isEmpty(), true);
 }
+
+// transactions differ by inner id and signature
+static std::vector<csdb::Transaction> makeTransactions(size_t count) {
+    std::vector<csdb::Transaction> transactions;
+    csdb::Transaction transaction;
+
+    transaction.set_source(csdb::Address::from_string("0000000000000000000000000000000000000000000000000000000000000007"));
+    transaction.set_target(csdb::Address::from_public_key(cs::PublicKey{}));
+    transaction.set_currency(csdb::Currency(1));
+    transaction.set_amount(csdb::Amount(10000, 0));
+
+    for (size_t i = 0; i < count; ++i) {
+        cs::Signature signature{};
+        std::copy(reinterpret_cast<const uint8_t*>(&i), reinterpret_cast<const uint8_t*>(&i) + sizeof(i), signature.begin());
+
+        transaction.set_innerID(static_cast<int64_t>(i + 1));
+        transaction.set_signature(signature);
+        transactions.push_back(transaction);
+    }
+
+    return transactions;
+}
+
+static size_t pushedCount(const std::vector<cs::PacketQueue::PushResult>& results) {
+    return static_cast<size_t>(std::count(results.begin(), results.end(), cs::PacketQueue::PushResult::Pushed));
+}
+
+TEST(PacketQueue, pushTransactionsBatchCountsTransactions) {
+    cs::PacketQueue queue = PacketCreator::create<PacketCreator::Default>();
+    const auto transactions = makeTransactions(kMaxPacketTransactions * 2 + 1);
+
+    ASSERT_EQ(pushedCount(queue.push(transactions)), transactions.size());
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(queue.transactionsCount(), transactions.size());
+
+    queue.pop();
+
+    ASSERT_EQ(queue.transactionsCount(), 0);
+}
+
+TEST(PacketQueue, pushTransactionsBatchStopsWhenQueueIsFull) {
+    cs::PacketQueue queue(3, kMaxPacketTransactions, kMaxPacketsPerRound);
+    const auto transactions = makeTransactions(kMaxPacketTransactions * 3);
+    const auto results = queue.push(transactions);
+
+    // transaction is pushed while queue holds less than max packets
+    ASSERT_EQ(pushedCount(results), kMaxPacketTransactions * 2 + 1);
+    ASSERT_EQ(results.back(), cs::PacketQueue::PushResult::Full);
+    ASSERT_EQ(queue.transactionsCount(), kMaxPacketTransactions * 2 + 1);
+}
+
+TEST(PacketQueue, pushTransactionsBatchRejectsDuplicates) {
+    cs::PacketQueue queue = PacketCreator::create<PacketCreator::Default>();
+    auto transactions = makeTransactions(3);
+
+    ASSERT_TRUE(queue.push(transactions[0]));
+
+    // repeated in batch with other inner id
+    auto repeated = transactions[1];
+    repeated.set_innerID(100);
+    transactions.push_back(repeated);
+
+    const auto results = queue.push(transactions);
+    const std::vector<cs::PacketQueue::PushResult> expected = {cs::PacketQueue::PushResult::Duplicate, cs::PacketQueue::PushResult::Pushed,
+                                                               cs::PacketQueue::PushResult::Pushed, cs::PacketQueue::PushResult::Duplicate};
+
+    ASSERT_EQ(results, expected);
+    ASSERT_EQ(queue.transactionsCount(), 3);
+
+    // signatures of flushed transactions may be queued again
+    queue.pop();
+
+    ASSERT_FALSE(queue.contains(transactions[0].signature()));
+    ASSERT_EQ(pushedCount(queue.push(transactions)), 3);
+}
@@ -0,0 +1,23 @@
+#ifndef PROJECT_PACKETSHELPER_HPP
+#define PROJECT_PACKETSHELPER_HPP
+
+#include <utility>
+
+#include <packet.hpp>
+
+// keys and packets shared by tests of network queues and stores
+inline cs::PublicKey makeKey(cs::Byte seed) {
+    cs::PublicKey key{};
+    key.fill(seed);
+    return key;
+}
+
+// packet of type with payload of size bytes filled by value
+inline Packet makePacket(MsgTypes type, size_t size, cs::Byte value) {
+    cs::Bytes bytes(static_cast<size_t>(Offsets::HeaderLength) + size, value);
+    bytes[0] = BaseFlags::Clear;
+    bytes[1] = type;
+    return Packet(std::move(bytes));
+}
+
+#endif  // PROJECT_PACKETSHELPER_HPP
@@ -0,0 +1,108 @@
+#define TESTING
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <packetsqueue.hpp>
+
+#include "gtest/gtest.h"
+
+#include "packetshelper.hpp"
+
+TEST(PacketsQueue, ServesFirstPriorityFirst) {
+    PacketsQueue queue(16);
+    const auto sender = makeKey(1);
+
+    ASSERT_TRUE(queue.push(sender, makePacket(MsgTypes::BlockRequest, 10, 1)));
+    ASSERT_TRUE(queue.push(sender, makePacket(MsgTypes::FirstStage, 10, 2)));
+
+    PacketsQueue::SenderAndPacket result;
+
+    ASSERT_TRUE(queue.pop(result));
+    ASSERT_EQ(result.second.getType(), MsgTypes::FirstStage);
+    ASSERT_TRUE(queue.pop(result));
+    ASSERT_EQ(result.second.getType(), MsgTypes::BlockRequest);
+    ASSERT_FALSE(queue.pop(result));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.size(), 0u);
+    ASSERT_EQ(queue.bytes(), 0u);
+}
+
+TEST(PacketsQueue, SendersTakeTurnsByBytes) {
+    constexpr size_t kFloodPackets = 64;
+    constexpr size_t kPacketSize = PacketsQueue::kQuantum / 4;
+
+    PacketsQueue queue(1024);
+    const auto flooder = makeKey(1);
+    const auto polite = makeKey(2);
+
+    for (size_t i = 0; i < kFloodPackets; ++i) {
+        ASSERT_TRUE(queue.push(flooder, makePacket(MsgTypes::FirstStage, kPacketSize, 1)));
+    }
+
+    ASSERT_TRUE(queue.push(polite, makePacket(MsgTypes::FirstStage, 10, 2)));
+    ASSERT_TRUE(queue.push(polite, makePacket(MsgTypes::FirstStage, 10, 3)));
+
+    std::vector<cs::PublicKey> senders;
+    std::vector<cs::Byte> politeValues;
+    PacketsQueue::SenderAndPacket result;
+
+    while (queue.pop(result)) {
+        senders.push_back(result.first);
+
+        if (result.first == polite) {
+            politeValues.push_back(*result.second.getMsgData());
+        }
+    }
+
+    ASSERT_EQ(senders.size(), kFloodPackets + 2);
+
+    // flooder spends its quantum on fewer than four packets, then polite sender goes with both
+    const auto firstPolite = std::find(senders.begin(), senders.end(), polite) - senders.begin();
+
+    ASSERT_LT(firstPolite, 4);
+    ASSERT_EQ(senders[static_cast<size_t>(firstPolite) + 1], polite);
+    ASSERT_EQ(politeValues, (std::vector<cs::Byte>{2, 3}));
+}
+
+TEST(PacketsQueue, SizeStaysInRangeWhilePoppedConcurrently) {
+    constexpr size_t kCapacity = 8;
+    constexpr size_t kPackets = 20000;
+
+    PacketsQueue queue(kCapacity);
+    std::atomic<bool> done = false;
+    size_t readerMaxSize = 0;
+    size_t writerMaxSize = 0;
+
+    std::thread reader([&]() {
+        PacketsQueue::SenderAndPacket result;
+
+        while (!done.load() || !queue.empty()) {
+            while (queue.pop(result)) {
+                readerMaxSize = std::max(readerMaxSize, queue.size());
+            }
+        }
+    });
+
+    size_t pushed = 0;
+    const auto sender = makeKey(1);
+
+    for (size_t i = 0; i < kPackets; ++i) {
+        if (queue.push(sender, makePacket(i % 2 ? MsgTypes::FirstStage : MsgTypes::BlockRequest, 10, 1))) {
+            ++pushed;
+        }
+
+        writerMaxSize = std::max(writerMaxSize, queue.size());
+    }
+
+    done = true;
+    reader.join();
+
+    ASSERT_LE(readerMaxSize, kCapacity * 2);
+    ASSERT_LE(writerMaxSize, kCapacity * 2);
+    ASSERT_EQ(pushed + queue.dropped(), kPackets);
+    ASSERT_EQ(queue.size(), 0u);
+    ASSERT_EQ(queue.bytes(), 0u);
+}
@@ -0,0 +1,70 @@
+#define TESTING
+
+#include <chrono>
+
+#include <peerquality.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+using namespace std::chrono_literals;
+
+PeerQuality measure(PeerQuality::Duration rtt, size_t count) {
+    PeerQuality quality;
+    auto now = PeerQuality::Clock::now();
+
+    for (size_t i = 0; i < count; ++i) {
+        quality.onRequest(now);
+        now += rtt;
+        quality.onReply(now);
+        now += 1s;
+    }
+
+    return quality;
+}
+}  // namespace
+
+TEST(PeerQuality, SmoothsRoundTripTime) {
+    PeerQuality quality;
+    auto now = PeerQuality::Clock::now();
+
+    ASSERT_FALSE(quality.onReply(now));
+    ASSERT_FALSE(quality.isMeasured());
+
+    quality.onRequest(now);
+    ASSERT_TRUE(quality.isAwaiting());
+    ASSERT_TRUE(quality.onReply(now + 100ms));
+    ASSERT_FALSE(quality.isAwaiting());
+
+    ASSERT_EQ(quality.rtt(), 100ms);
+    ASSERT_EQ(quality.jitter(), 50ms);
+
+    quality.onRequest(now);
+    quality.onReply(now + 180ms);
+
+    ASSERT_EQ(quality.rtt(), 110ms);
+    ASSERT_EQ(quality.jitter(), 57500us);
+}
+
+TEST(PeerQuality, CountsLostRequests) {
+    auto quality = measure(10ms, 1);
+    const auto score = quality.score();
+    auto now = PeerQuality::Clock::now();
+
+    quality.onRequest(now);
+    quality.onRequest(now + 2s);
+
+    ASSERT_TRUE(quality.isAwaiting());
+    ASSERT_LT(quality.deliveryRate(), 1.0);
+    ASSERT_GT(quality.score(), score);
+}
+
+TEST(PeerQuality, RanksMeasuredPeersFirst) {
+    const auto fast = measure(5ms, 5);
+    const auto slow = measure(500ms, 5);
+
+    ASSERT_TRUE(PeerQuality::isBetter(fast, slow));
+    ASSERT_FALSE(PeerQuality::isBetter(slow, fast));
+    ASSERT_TRUE(PeerQuality::isBetter(slow, PeerQuality{}));
+    ASSERT_EQ(PeerQuality{}.score(), PeerQuality::Duration::max());
+}
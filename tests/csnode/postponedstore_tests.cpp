@@ -0,0 +1,78 @@
+#define TESTING
+
+#include <postponedstore.hpp>
+
+#include "gtest/gtest.h"
+
+#include "packetshelper.hpp"
+
+namespace {
+// store quotas are checked against whole packet size
+Packet makeRoundPacket(size_t size, cs::Byte value) {
+    return makePacket(MsgTypes::BlockHash, size - static_cast<size_t>(Offsets::HeaderLength), value);
+}
+}  // namespace
+
+TEST(PostponedStore, TakesPacketsOfRoundWithoutCopy) {
+    PostponedStore store;
+    const auto sender = makeKey(1);
+
+    auto pack = makeRoundPacket(100, 8);
+    const auto buffer = pack.data();
+
+    ASSERT_TRUE(store.add(sender, 10, makeRoundPacket(100, 7)));
+    ASSERT_TRUE(store.add(sender, 11, std::move(pack)));
+    ASSERT_TRUE(store.add(sender, 12, makeRoundPacket(100, 9)));
+
+    const auto packs = store.take(11);
+
+    ASSERT_EQ(packs.size(), 1u);
+    ASSERT_EQ(packs.front().sender, sender);
+    ASSERT_EQ(packs.front().pack.data(), buffer);
+
+    // round 10 is forgotten
+    const auto metrics = store.getMetrics();
+
+    ASSERT_EQ(metrics.packets, 1u);
+    ASSERT_EQ(metrics.bytes, 100u);
+    ASSERT_EQ(metrics.rounds, 1u);
+    ASSERT_TRUE(store.take(10).empty());
+}
+
+TEST(PostponedStore, RejectsPacketsOverSenderQuota) {
+    PostponedStore store(1000, 300);
+    const auto flooder = makeKey(1);
+    const auto other = makeKey(2);
+
+    ASSERT_TRUE(store.add(flooder, 10, makeRoundPacket(200, 1)));
+    ASSERT_FALSE(store.add(flooder, 10, makeRoundPacket(200, 1)));
+    ASSERT_TRUE(store.add(other, 10, makeRoundPacket(200, 2)));
+
+    ASSERT_EQ(store.take(10).size(), 2u);
+
+    // quota is released with taken packets
+    ASSERT_TRUE(store.add(flooder, 11, makeRoundPacket(200, 1)));
+    ASSERT_EQ(store.getMetrics().rejected, 1u);
+}
+
+TEST(PostponedStore, EvictsFurthestRoundsFirst) {
+    PostponedStore store(300, 300);
+
+    ASSERT_TRUE(store.add(makeKey(1), 10, makeRoundPacket(100, 1)));
+    ASSERT_TRUE(store.add(makeKey(2), 1000, makeRoundPacket(100, 2)));
+    ASSERT_TRUE(store.add(makeKey(3), 500, makeRoundPacket(100, 3)));
+
+    // the furthest round gives way to a nearer one
+    ASSERT_TRUE(store.add(makeKey(4), 11, makeRoundPacket(100, 4)));
+
+    // nothing further than round 1001 to evict
+    ASSERT_FALSE(store.add(makeKey(5), 1001, makeRoundPacket(100, 5)));
+
+    const auto metrics = store.getMetrics();
+
+    ASSERT_EQ(metrics.packets, 3u);
+    ASSERT_EQ(metrics.evicted, 1u);
+    ASSERT_EQ(metrics.rejected, 1u);
+    ASSERT_EQ(store.take(500).size(), 1u);
+    ASSERT_TRUE(store.take(1000).empty());
+}
@@ -0,0 +1,69 @@
+#include <roundpackage.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+cs::RoundPackage makePackage(cs::RoundNumber round) {
+    cs::RoundTable table;
+    table.round = round;
+    table.confidants.resize(3);
+
+    for (size_t i = 0; i < table.confidants.size(); ++i) {
+        table.confidants[i].fill(static_cast<cs::Byte>(i + 1));
+    }
+
+    cs::PoolMetaInfo meta;
+    meta.sequenceNumber = round - 1;
+    meta.timestamp = "1600000000000";
+    meta.realTrustedMask = {0, 1, 2};
+
+    cs::RoundPackage package;
+    package.updateRoundTable(table);
+    package.updatePoolMeta(meta);
+
+    return package;
+}
+}  // namespace
+
+TEST(RoundPackage, CachesBytesToSignAndHash) {
+    auto package = makePackage(10);
+
+    const cs::Bytes bytes = package.bytesToSign();
+    const auto& cached = package.bytesToSign();
+
+    ASSERT_EQ(bytes, cached);
+    ASSERT_EQ(&cached, &package.bytesToSign());
+    ASSERT_EQ(package.hashToSign(), cscrypto::calculateHash(bytes.data(), bytes.size()));
+
+    const cs::Bytes table = package.roundTable().toBinary();
+    ASSERT_EQ(package.roundTableHash(), cscrypto::calculateHash(table.data(), table.size()));
+}
+
+TEST(RoundPackage, UpdatesCacheWithRoundTable) {
+    auto package = makePackage(10);
+    const auto hash = package.hashToSign();
+    const auto tableHash = package.roundTableHash();
+
+    auto table = package.roundTable();
+    table.confidants.front().fill(0);
+    package.updateRoundTable(table);
+
+    ASSERT_NE(package.hashToSign(), hash);
+    ASSERT_NE(package.roundTableHash(), tableHash);
+}
+
+TEST(RoundPackage, KeepsBytesToSignAtBinaryStart) {
+    auto package = makePackage(10);
+    const cs::Bytes bytes = package.bytesToSign();
+
+    const cs::Signatures signatures(3, cs::Signature{});
+    package.updateRoundSignatures(signatures);
+    package.updatePoolSignatures(signatures);
+    package.updateTrustedSignatures(signatures);
+
+    const auto& binary = package.toBinary();
+
+    ASSERT_GT(binary.size(), bytes.size());
+    ASSERT_TRUE(std::equal(bytes.begin(), bytes.end(), binary.begin()));
+    ASSERT_EQ(package.bytesToSign(), bytes);
+}
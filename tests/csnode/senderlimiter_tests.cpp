@@ -0,0 +1,71 @@
+#define TESTING
+
+#include <chrono>
+
+#include <senderlimiter.hpp>
+
+#include "gtest/gtest.h"
+
+#include "packetshelper.hpp"
+
+TEST(SenderLimiter, ThrottlesSenderAboveBurstOnly) {
+    constexpr size_t kPacketSize = 1024;
+    constexpr size_t kCost = kPacketSize + SenderLimiter::kPacketCost;
+
+    SenderLimiter limiter(kCost, kCost * 3);
+
+    const auto flooder = makeKey(1);
+    const auto other = makeKey(2);
+    const auto now = SenderLimiter::Clock::now();
+
+    for (size_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(limiter.take(flooder, kPacketSize, now));
+    }
+
+    ASSERT_FALSE(limiter.take(flooder, kPacketSize, now));
+    ASSERT_TRUE(limiter.take(other, kPacketSize, now));
+
+    // rate is one packet per second
+    ASSERT_TRUE(limiter.take(flooder, kPacketSize, now + std::chrono::seconds(1)));
+    ASSERT_FALSE(limiter.take(flooder, kPacketSize, now + std::chrono::seconds(1)));
+
+    ASSERT_EQ(limiter.throttled(), 2u);
+
+    const auto throttled = limiter.getThrottledSenders();
+
+    ASSERT_EQ(throttled.size(), 1u);
+    ASSERT_EQ(throttled.front().first, flooder);
+    ASSERT_EQ(throttled.front().second.throttled, 2u);
+    ASSERT_EQ(throttled.front().second.throttledBytes, kPacketSize * 2);
+}
+
+TEST(SenderLimiter, PassesPacketLargerThanBurstFromFullBucket) {
+    SenderLimiter limiter(1000, 10'000);
+
+    const auto sender = makeKey(1);
+    const auto now = SenderLimiter::Clock::now();
+
+    ASSERT_TRUE(limiter.take(sender, 50'000, now));
+    ASSERT_FALSE(limiter.take(sender, 10, now + std::chrono::seconds(10)));
+    ASSERT_TRUE(limiter.take(sender, 10, now + std::chrono::seconds(60)));
+}
+
+TEST(SenderLimiter, PrunesRefilledBucketsOfPoliteSenders) {
+    SenderLimiter limiter(1000, 10'000);
+
+    const auto polite = makeKey(1);
+    const auto flooder = makeKey(2);
+    const auto now = SenderLimiter::Clock::now();
+
+    ASSERT_TRUE(limiter.take(polite, 100, now));
+    ASSERT_TRUE(limiter.take(flooder, 10'000, now));
+    ASSERT_FALSE(limiter.take(flooder, 100, now));
+
+    limiter.prune(now + std::chrono::seconds(60));
+
+    // counters of throttled sender are kept
+    const auto throttled = limiter.getThrottledSenders();
+
+    ASSERT_EQ(throttled.size(), 1u);
+    ASSERT_EQ(throttled.front().first, flooder);
+}
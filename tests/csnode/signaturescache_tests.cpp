@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <csnode/signaturescache.hpp>
+
+static cs::Hash makeHash(size_t value) {
+    cs::Hash hash{};
+    std::copy(reinterpret_cast<const cs::Byte*>(&value), reinterpret_cast<const cs::Byte*>(&value) + sizeof(value), hash.begin());
+    hash.back() = static_cast<cs::Byte>(value);
+    return hash;
+}
+
+TEST(SignaturesCache, CountsHitsAndMisses) {
+    cs::SignaturesCache cache;
+    const auto key = makeHash(1);
+
+    ASSERT_FALSE(cache.contains(key));
+    cache.insert(key);
+    ASSERT_TRUE(cache.contains(key));
+    ASSERT_TRUE(cache.contains(key));
+
+    const auto statistics = cache.takeStatistics();
+    ASSERT_EQ(statistics.hits, 2);
+    ASSERT_EQ(statistics.misses, 1);
+
+    ASSERT_EQ(cache.statistics().hits, 0);
+}
+
+TEST(SignaturesCache, EvictsOldestEntries) {
+    const size_t capacity = cs::SignaturesCache::kShardsCount * 4;
+    cs::SignaturesCache cache(capacity);
+
+    for (size_t i = 0; i < capacity * 2; ++i) {
+        cache.insert(makeHash(i));
+    }
+
+    ASSERT_EQ(cache.size(), capacity);
+    ASSERT_FALSE(cache.contains(makeHash(0)));
+    ASSERT_TRUE(cache.contains(makeHash(capacity * 2 - 1)));
+}
+
+TEST(SignaturesCache, KeyDependsOnSignature) {
+    const auto messageHash = makeHash(1);
+    const cs::PublicKey key{};
+    cs::Signature signature{};
+
+    const auto first = cs::SignaturesCache::makeKey(messageHash, key, signature);
+    signature[0] = 1;
+
+    ASSERT_NE(first, cs::SignaturesCache::makeKey(messageHash, key, signature));
+    ASSERT_NE(first, cs::SignaturesCache::makeKey(makeHash(2), key, cs::Signature{}));
+}
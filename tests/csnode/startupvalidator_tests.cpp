@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <csnode/startupvalidator.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+// replaces block validator, blocks from invalidSequence are invalid
+class TestStartupValidator : public cs::StartupValidator {
+public:
+    explicit TestStartupValidator(const std::string& dbPath)
+    : cs::StartupValidator(dbPath) {
+    }
+
+    cs::Sequence invalidSequence = std::numeric_limits<cs::Sequence>::max();
+
+    size_t checkedCount = 0;
+    std::vector<size_t> rangeSizes;
+
+protected:
+    bool validateCheckpointed(const csdb::Pool& block) override {
+        ++checkedCount;
+        return block.sequence() < invalidSequence;
+    }
+
+    size_t validateBlocks(const std::vector<csdb::Pool>& blocks) override {
+        rangeSizes.push_back(blocks.size());
+        auto it = std::find_if(blocks.begin(), blocks.end(), [this](const csdb::Pool& block) { return block.sequence() >= invalidSequence; });
+        return static_cast<size_t>(std::distance(blocks.begin(), it));
+    }
+};
+
+// chains of different salts have different hashes of the same sequence
+csdb::Pool makeBlock(cs::Sequence sequence, cs::Byte salt = 0) {
+    csdb::Pool block(csdb::PoolHash::calc_from_data(cs::Bytes{salt, static_cast<cs::Byte>(sequence)}), sequence);
+    block.compose();
+    return block;
+}
+
+// reads blocks 0..lastSequence, returns false on the first failed one
+bool readChain(TestStartupValidator& validator, cs::Sequence lastSequence, cs::Byte salt = 0) {
+    validator.onStartReading(lastSequence);
+
+    for (cs::Sequence sequence = 0; sequence <= lastSequence; ++sequence) {
+        if (!validator.onReadBlock(makeBlock(sequence, salt))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+class StartupValidatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dbPath_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("startupvalidator-%%%%-%%%%");
+        boost::filesystem::create_directories(dbPath_);
+    }
+
+    void TearDown() override {
+        boost::filesystem::remove_all(dbPath_);
+    }
+
+    std::string dbPath() const {
+        return dbPath_.string();
+    }
+
+private:
+    boost::filesystem::path dbPath_;
+};
+}  // namespace
+
+TEST_F(StartupValidatorTest, ShortFinalRangeIsValidated) {
+    constexpr cs::Sequence kLastSequence = cs::StartupValidator::kRangeSize + 9;
+
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, kLastSequence));
+
+        ASSERT_EQ(validator.rangeSizes.size(), 2u);
+        ASSERT_EQ(validator.rangeSizes[0], cs::StartupValidator::kRangeSize);
+        ASSERT_EQ(validator.rangeSizes[1], 9u);
+        ASSERT_EQ(validator.checkpoint(), kLastSequence);
+    }
+
+    TestStartupValidator validator(dbPath());
+    ASSERT_EQ(validator.checkpoint(), kLastSequence);
+    ASSERT_TRUE(readChain(validator, kLastSequence));
+    ASSERT_TRUE(validator.rangeSizes.empty());
+    ASSERT_EQ(validator.checkedCount, kLastSequence + 1);
+}
+
+TEST_F(StartupValidatorTest, ResumesAfterCheckpoint) {
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, 99));
+    }
+
+    TestStartupValidator validator(dbPath());
+    ASSERT_TRUE(readChain(validator, 149));
+
+    ASSERT_EQ(validator.checkedCount, 100u);
+    ASSERT_EQ(validator.rangeSizes, std::vector<size_t>{50});
+    ASSERT_EQ(validator.checkpoint(), 149u);
+}
+
+TEST_F(StartupValidatorTest, CheckpointBeyondLastBlockIsReset) {
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, 99));
+    }
+
+    {
+        TestStartupValidator validator(dbPath());
+        validator.onStartReading(49);
+        ASSERT_EQ(validator.checkpoint(), 0u);
+        ASSERT_FALSE(validator.isCheckpointed(1));
+    }
+
+    // reset is stored
+    TestStartupValidator validator(dbPath());
+    ASSERT_EQ(validator.checkpoint(), 0u);
+}
+
+TEST_F(StartupValidatorTest, HashMismatchDropsCheckpoint) {
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, 99));
+    }
+
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, 149, 1));
+
+        // checkpoint is not advanced on the differing chain
+        ASSERT_EQ(validator.checkpoint(), 99u);
+        ASSERT_EQ(validator.rangeSizes, std::vector<size_t>{50});
+    }
+
+    TestStartupValidator validator(dbPath());
+    ASSERT_EQ(validator.checkpoint(), 0u);
+}
+
+TEST_F(StartupValidatorTest, CheckpointStopsAtLastValidBlock) {
+    constexpr cs::Sequence kInvalidSequence = cs::StartupValidator::kRangeSize + 100;
+
+    {
+        TestStartupValidator validator(dbPath());
+        validator.invalidSequence = kInvalidSequence;
+
+        ASSERT_FALSE(readChain(validator, cs::StartupValidator::kRangeSize * 2));
+        ASSERT_EQ(validator.checkpoint(), kInvalidSequence - 1);
+    }
+
+    TestStartupValidator validator(dbPath());
+    ASSERT_EQ(validator.checkpoint(), kInvalidSequence - 1);
+}
+
+TEST_F(StartupValidatorTest, InvalidFirstBlockOfRangeKeepsCheckpoint) {
+    {
+        TestStartupValidator validator(dbPath());
+        ASSERT_TRUE(readChain(validator, 99));
+    }
+
+    TestStartupValidator validator(dbPath());
+    validator.invalidSequence = 100;
+
+    ASSERT_FALSE(readChain(validator, 149));
+    ASSERT_EQ(validator.checkpoint(), 99u);
+}
@@ -0,0 +1,107 @@
+#define TESTING
+
+#include <chrono>
+#include <vector>
+
+#include <csnode/syncscheduler.hpp>
+
+#include "gtest/gtest.h"
+
+#include "packetshelper.hpp"
+
+namespace {
+using Scheduler = cs::SyncScheduler;
+
+Scheduler::Settings makeSettings() {
+    Scheduler::Settings settings;
+    settings.initialRequestSize = 10;
+    settings.maxRequestsInFlight = 4;
+    settings.initialRtt = std::chrono::seconds(1);
+    return settings;
+}
+
+size_t requestedCount(const std::vector<Scheduler::Request>& requests) {
+    size_t count = 0;
+
+    for (const auto& request : requests) {
+        count += request.sequences.size();
+    }
+
+    return count;
+}
+}  // namespace
+
+TEST(SyncScheduler, RequestsWithinLimitAndNeighbourSequence) {
+    Scheduler scheduler(makeSettings());
+    scheduler.addNeighbour(makeKey(1), 15);
+
+    const auto now = Scheduler::Clock::now();
+    const auto requests = scheduler.schedule({{1, 0}}, 100, now);
+
+    ASSERT_EQ(requests.size(), 2u);
+    ASSERT_EQ(requests[0].sequences.front(), 1u);
+    ASSERT_EQ(requests[0].sequences.size(), 10u);
+    ASSERT_EQ(requests[1].sequences.back(), 15u);
+    ASSERT_EQ(scheduler.inFlightCount(), 15u);
+
+    Scheduler limited(makeSettings());
+    limited.addNeighbour(makeKey(1), 1000);
+
+    ASSERT_EQ(requestedCount(limited.schedule({{1, 0}}, 5, now)), 5u);
+}
+
+TEST(SyncScheduler, ReassignsExpiredRequest) {
+    Scheduler scheduler(makeSettings());
+    scheduler.addNeighbour(makeKey(1), 1000);
+
+    auto now = Scheduler::Clock::now();
+    const auto silent = scheduler.schedule({{1, 10}}, 1000, now);
+
+    ASSERT_EQ(silent.size(), 1u);
+    ASSERT_TRUE(scheduler.schedule({{1, 10}}, 1000, now).empty());
+
+    scheduler.addNeighbour(makeKey(2), 1000);
+    now += std::chrono::seconds(5);
+
+    const auto requests = scheduler.schedule({{1, 10}}, 1000, now);
+
+    ASSERT_EQ(scheduler.timeoutsCount(), 1u);
+    ASSERT_EQ(requestedCount(requests), 10u);
+    ASSERT_EQ(requests.front().sequences.front(), 1u);
+}
+
+TEST(SyncScheduler, RequestsLowestSequencesFromNearestNeighbour) {
+    Scheduler scheduler(makeSettings());
+    scheduler.addNeighbour(makeKey(1), 1000);
+    scheduler.addNeighbour(makeKey(2), 1000);
+    scheduler.setNeighbourRtt(makeKey(1), std::chrono::milliseconds(300));
+    scheduler.setNeighbourRtt(makeKey(2), std::chrono::milliseconds(20));
+
+    const auto requests = scheduler.schedule({{1, 0}}, 1000, Scheduler::Clock::now());
+
+    ASSERT_FALSE(requests.empty());
+    ASSERT_EQ(requests.front().target, makeKey(2));
+    ASSERT_EQ(requests.front().sequences.front(), 1u);
+}
+
+TEST(SyncScheduler, GrowsRequestsOfFastNeighbour) {
+    Scheduler scheduler(makeSettings());
+    const auto key = makeKey(1);
+    scheduler.addNeighbour(key, 100000);
+
+    auto now = Scheduler::Clock::now();
+    auto requests = scheduler.schedule({{1, 0}}, 100000, now);
+
+    // the first request is answered with 10 blocks in 20 ms
+    now += std::chrono::milliseconds(20);
+    scheduler.onReply(key, requests.front().sequences, now);
+
+    for (auto sequence : requests.front().sequences) {
+        scheduler.onStored(sequence);
+    }
+
+    requests = scheduler.schedule({{requests.front().sequences.back() + 1, 0}}, 100000, now);
+
+    ASSERT_FALSE(requests.empty());
+    ASSERT_EQ(requests.back().sequences.size(), makeSettings().maxRequestSize);
+}
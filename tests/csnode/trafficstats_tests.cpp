@@ -0,0 +1,50 @@
+#define TESTING
+
+#include <trafficstats.hpp>
+
+#include "gtest/gtest.h"
+
+TEST(TrafficStats, SelectsHistogramBucketByDecade) {
+    ASSERT_EQ(TrafficStats::getHistogramBucket(0), 0u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(9), 0u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(10), 1u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(999), 2u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(1'000), 3u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(999'999), 5u);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(1'000'000), TrafficStats::kHistogramSize - 1);
+    ASSERT_EQ(TrafficStats::getHistogramBucket(100'000'000), TrafficStats::kHistogramSize - 1);
+}
+
+TEST(TrafficStats, CountsMessagesByType) {
+    TrafficStats stats;
+
+    stats.onReceived(MsgTypes::FirstStage, 100, 150);
+    stats.onReceived(MsgTypes::FirstStage, 50, 50);
+    stats.onSent(MsgTypes::FirstStage, 80, 100, 3);
+    stats.onDropped(MsgTypes::FirstStage);
+    stats.onRejected(MsgTypes::TransactionPacket);
+    stats.onDuplicate(MsgTypes::TransactionPacket);
+    stats.onThrottled(MsgTypes::FirstStage);
+    stats.onHandled(MsgTypes::FirstStage, 5);
+    stats.onHandled(MsgTypes::FirstStage, 2'000);
+
+    const auto stage = stats.get(MsgTypes::FirstStage);
+
+    ASSERT_EQ(stage.packetsIn, 2u);
+    ASSERT_EQ(stage.bytesIn, 150u);
+    ASSERT_EQ(stage.unpackedBytesIn, 200u);
+    ASSERT_EQ(stage.packetsOut, 3u);
+    ASSERT_EQ(stage.bytesOut, 240u);
+    ASSERT_EQ(stage.unpackedBytesOut, 300u);
+    ASSERT_EQ(stage.dropped, 1u);
+    ASSERT_EQ(stage.throttled, 1u);
+    ASSERT_EQ(stage.rejected, 0u);
+    ASSERT_EQ(stage.handled, 2u);
+    ASSERT_EQ(stage.handlingTimeUs, 2'005u);
+    ASSERT_EQ(stage.handlingTimeHistogram[0], 1u);
+    ASSERT_EQ(stage.handlingTimeHistogram[3], 1u);
+
+    ASSERT_EQ(stats.get(MsgTypes::TransactionPacket).rejected, 1u);
+    ASSERT_EQ(stats.get(MsgTypes::TransactionPacket).duplicates, 1u);
+    ASSERT_EQ(stats.get(MsgTypes::SecondStage).packetsIn, 0u);
+}
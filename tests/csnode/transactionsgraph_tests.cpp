@@ -0,0 +1,116 @@
+#define TESTING
+
+#include <vector>
+
+#include <csdb/amount_commission.hpp>
+#include <csdb/currency.hpp>
+#include <csnode/transactionsgraph.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+using Graph = cs::TransactionsGraph;
+
+// wallets are addressed by wallet id equal to index + 1
+struct Round {
+    explicit Round(size_t walletsCount, csdb::Amount balance = csdb::Amount(0)) : wallets(walletsCount) {
+        for (auto& wallet : wallets) {
+            wallet.lastTrxInd_ = cs::WalletsState::noInd_;
+            wallet.balance_ = balance;
+        }
+    }
+
+    // applies transaction the same way validator does
+    void add(size_t source, size_t target, csdb::Amount amount) {
+        csdb::Transaction trx;
+        trx.set_innerID(static_cast<int64_t>(trxs.size() + 1));
+        trx.set_source(csdb::Address::from_wallet_id(static_cast<csdb::internal::WalletId>(source + 1)));
+        trx.set_target(csdb::Address::from_wallet_id(static_cast<csdb::internal::WalletId>(target + 1)));
+        trx.set_currency(csdb::Currency(1));
+        trx.set_amount(amount);
+        trx.set_max_fee(csdb::AmountCommission(0.1));
+        trx.set_counted_fee(csdb::AmountCommission(0.001));
+
+        auto& sourceWallet = wallets[source];
+        sourceWallet.balance_ = sourceWallet.balance_ - amount - csdb::Amount(trx.counted_fee().to_double());
+        wallets[target].balance_ = wallets[target].balance_ + amount;
+
+        if (sourceWallet.balance_ < csdb::Amount(0)) {
+            negativeNodes.push_back(&sourceWallet);
+        }
+
+        trxList.push_back(sourceWallet.lastTrxInd_);
+        sourceWallet.lastTrxInd_ = static_cast<Graph::TransactionIndex>(trxs.size());
+        trxs.push_back(trx);
+    }
+
+    size_t resolve() {
+        mask.assign(trxs.size(), Reject::Reason::None);
+
+        Graph graph(trxs, trxList, mask);
+        return graph.resolve(negativeNodes, [this](const csdb::Address& target) {
+            return Graph::Target{&wallets[target.wallet_id() - 1], false};
+        });
+    }
+
+    std::vector<Graph::Node> wallets;
+    Graph::Transactions trxs;
+    Graph::TrxList trxList;
+    Graph::Stack negativeNodes;
+    cs::Bytes mask;
+};
+}  // namespace
+
+TEST(TransactionsGraph, RemovesNegativeChain) {
+    Round round(3);
+
+    // wallet 1 spends before it is paid by wallet 0 which has no funds
+    round.add(1, 2, csdb::Amount(10));
+    round.add(0, 1, csdb::Amount(10));
+
+    ASSERT_EQ(round.resolve(), 2u);
+    ASSERT_EQ(round.mask[0], Reject::Reason::NegativeResult);
+    ASSERT_EQ(round.mask[1], Reject::Reason::NegativeResult);
+    ASSERT_TRUE(round.negativeNodes.empty());
+
+    for (const auto& wallet : round.wallets) {
+        ASSERT_DOUBLE_EQ(wallet.balance_.to_double(), 0.0);
+    }
+}
+
+TEST(TransactionsGraph, RemovesSingleCoveringTransaction) {
+    Round round(3, csdb::Amount(5));
+
+    round.add(0, 1, csdb::Amount(3));
+    round.add(0, 2, csdb::Amount(4));
+
+    ASSERT_EQ(round.resolve(), 1u);
+    ASSERT_EQ(round.mask[0], Reject::Reason::None);
+    ASSERT_EQ(round.mask[1], Reject::Reason::NegativeResult);
+    ASSERT_GE(round.wallets[0].balance_, csdb::Amount(0));
+}
+
+TEST(TransactionsGraph, ResolvesComponentsIndependently) {
+    constexpr size_t groupsCount = 100;
+    constexpr size_t groupSize = 4;
+
+    Round round(groupsCount * groupSize);
+
+    for (size_t group = 0; group < groupsCount; ++group) {
+        const size_t first = group * groupSize;
+
+        round.add(first + 2, first + 3, csdb::Amount(5));
+        round.add(first + 1, first + 2, csdb::Amount(5));
+        round.add(first, first + 1, csdb::Amount(5));
+    }
+
+    ASSERT_EQ(round.resolve(), groupsCount * 3);
+
+    for (auto reason : round.mask) {
+        ASSERT_EQ(reason, Reject::Reason::NegativeResult);
+    }
+
+    for (const auto& wallet : round.wallets) {
+        ASSERT_DOUBLE_EQ(wallet.balance_.to_double(), 0.0);
+    }
+}
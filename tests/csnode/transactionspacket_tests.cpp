@@ -222,6 +222,27 @@ TEST(TransactionsPacket, moveOperator) {
     ASSERT_EQ(copiedPacket.toBinary(), movedPacket.toBinary());
 }
 
+TEST(TransactionsPacket, sharedPacketCachesBinary) {
+    cs::TransactionsPacket packet;
+
+    for (int64_t i = 0; i < 100; ++i) {
+        packet.addTransaction(makeTransaction(i));
+    }
+
+    cs::TransactionsPacket copiedPacket = packet;
+    cs::TransactionsPacketPtr shared = cs::TransactionsPacket::share(std::move(packet));
+
+    ASSERT_FALSE(shared->isHashEmpty());
+    ASSERT_NE(shared->cachedBinary(), nullptr);
+    ASSERT_EQ(*shared->cachedBinary(), copiedPacket.toBinary());
+
+    cs::TransactionsPacket modifiedPacket = *shared;
+    modifiedPacket.setExpiredRound(shared->expiredRound() + 1);
+
+    ASSERT_EQ(modifiedPacket.cachedBinary(), nullptr);
+    ASSERT_NE(modifiedPacket.toBinary(), *shared->cachedBinary());
+}
+
 TEST(TransactionPacketHash, fromBinary) {
     auto startAddress = csdb::Address::from_string("0000000000000000000000000000000000000000000000000000000000000007");
 
@@ -0,0 +1,75 @@
+#define TESTING
+
+#include <algorithm>
+#include <vector>
+
+#include <csnode/walletsids.hpp>
+#include <csnode/walletsstate.hpp>
+
+#include "gtest/gtest.h"
+
+namespace {
+csdb::Address makeAddress(size_t seed) {
+    cs::PublicKey key{};
+    std::copy_n(reinterpret_cast<const cs::Byte*>(&seed), sizeof(seed), key.begin());
+    return csdb::Address::from_public_key(key);
+}
+}  // namespace
+
+class WalletsStateTest : public ::testing::Test {
+protected:
+    WalletsStateTest()
+    : cache_(ids_)
+    , updater_(cache_.createUpdater())
+    , state_(*updater_) {
+    }
+
+    cs::WalletsIds ids_;
+    cs::WalletsCache cache_;
+    std::unique_ptr<cs::WalletsCache::Updater> updater_;
+    cs::WalletsState state_;
+};
+
+TEST_F(WalletsStateTest, ReturnsSameDataInRound) {
+    auto& first = state_.getData(makeAddress(1));
+    first.balance_ = csdb::Amount(10);
+
+    auto& second = state_.getData(makeAddress(2));
+
+    ASSERT_EQ(&first, &state_.getData(makeAddress(1)));
+    ASSERT_NE(&first, &second);
+    ASSERT_EQ(state_.getData(makeAddress(1)).balance_, csdb::Amount(10));
+    ASSERT_EQ(state_.size(), 2u);
+}
+
+TEST_F(WalletsStateTest, DropsChangesOnReset) {
+    auto& data = state_.getData(makeAddress(1));
+    data.balance_ = csdb::Amount(10);
+    data.lastTrxInd_ = 5;
+
+    state_.updateFromSource();
+    ASSERT_EQ(state_.size(), 0u);
+
+    auto& fresh = state_.getData(makeAddress(1));
+    ASSERT_EQ(fresh.balance_, csdb::Amount(0));
+    ASSERT_EQ(fresh.lastTrxInd_, cs::WalletsState::noInd_);
+    ASSERT_EQ(fresh.cached_, nullptr);
+    ASSERT_EQ(fresh.delegateTarget(cs::PublicKey{}), nullptr);
+}
+
+TEST_F(WalletsStateTest, ReusesMemoryBetweenRounds) {
+    constexpr size_t count = cs::WalletsState::kChunkSize * 3;
+    std::vector<const cs::WalletsState::WalletData*> previous;
+
+    for (size_t i = 0; i < count; ++i) {
+        previous.push_back(&state_.getData(makeAddress(i + 1)));
+    }
+
+    state_.updateFromSource();
+
+    // the same count of other wallets takes the same copies
+    for (size_t i = 0; i < count; ++i) {
+        auto& data = state_.getData(makeAddress(count + i + 1));
+        ASSERT_EQ(&data, previous[i]);
+    }
+}
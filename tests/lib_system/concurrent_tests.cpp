@@ -4,6 +4,7 @@
 #include <lib/system/console.hpp>
 #include <lib/system/random.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <string>
@@ -411,3 +412,38 @@ TEST(Concurrent, FutureWatcherHighMultithreading) {
 
     ASSERT_EQ(currentThreadPoolSum, expectedSum);
 }
+
+TEST(Concurrent, ParallelForVisitsEachIndexOnce) {
+    constexpr size_t count = 10000;
+    std::vector<std::atomic<size_t>> visits(count);
+
+    cs::Concurrent::parallelFor(count, 16, [&](size_t index) {
+        ++visits[index];
+    });
+
+    ASSERT_TRUE(std::all_of(visits.begin(), visits.end(), [](const auto& value) { return value == 1; }));
+}
+
+TEST(Concurrent, ParallelForFromThreadPool) {
+    constexpr size_t tasks = 64;
+    constexpr size_t count = 1000;
+
+    std::atomic<size_t> sum = 0;
+    std::atomic<size_t> finished = 0;
+
+    for (size_t i = 0; i < tasks; ++i) {
+        cs::Concurrent::run([&] {
+            cs::Concurrent::parallelFor(count, 1, [&](size_t index) {
+                sum += index;
+            });
+
+            ++finished;
+        });
+    }
+
+    while (finished != tasks) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(sum, tasks * count * (count - 1) / 2);
+}
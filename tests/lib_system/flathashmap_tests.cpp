@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <unordered_map>
+
+#include <lib/system/common.hpp>
+#include <lib/system/flathashmap.hpp>
+#include <lib/system/random.hpp>
+
+using TestFlatHashMap = cs::FlatHashMap<cs::Hash, size_t>;
+
+static cs::Hash makeKey(size_t value) {
+    cs::Hash key{};
+    std::copy(reinterpret_cast<const uint8_t*>(&value), reinterpret_cast<const uint8_t*>(&value) + sizeof(value), key.begin() + sizeof(value));
+    return key;
+}
+
+TEST(FlatHashMap, DefaultCreation) {
+    TestFlatHashMap map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_TRUE(map.find(makeKey(1)) == map.end());
+}
+
+TEST(FlatHashMap, InsertAndFind) {
+    TestFlatHashMap map;
+    constexpr size_t count = 10000;
+
+    for (size_t i = 0; i < count; ++i) {
+        auto [iterator, inserted] = map.emplace(makeKey(i), i);
+
+        ASSERT_TRUE(inserted);
+        ASSERT_EQ(iterator->second, i);
+    }
+
+    ASSERT_EQ(map.size(), count);
+    ASSERT_FALSE(map.emplace(makeKey(0), count).second);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto iterator = map.find(makeKey(i));
+
+        ASSERT_TRUE(iterator != map.end());
+        ASSERT_EQ(iterator->second, i);
+    }
+}
+
+TEST(FlatHashMap, ReferencesAreStableAfterRehash) {
+    TestFlatHashMap map;
+
+    size_t& value = map[makeKey(0)];
+    value = 100;
+
+    for (size_t i = 1; i < 5000; ++i) {
+        map[makeKey(i)] = i;
+    }
+
+    ASSERT_EQ(&value, &map.at(makeKey(0)));
+    ASSERT_EQ(value, 100);
+}
+
+TEST(FlatHashMap, EraseMatchesUnorderedMap) {
+    TestFlatHashMap map;
+    std::unordered_map<cs::Hash, size_t> expected;
+
+    for (size_t i = 0; i < 50000; ++i) {
+        const auto key = makeKey(cs::Random::generateValue<size_t>(0, 2000));
+
+        if (cs::Random::generateValue<int>(0, 2) == 0) {
+            ASSERT_EQ(map.erase(key), expected.erase(key));
+        }
+        else {
+            map[key] = i;
+            expected[key] = i;
+        }
+    }
+
+    ASSERT_EQ(map.size(), expected.size());
+
+    size_t iterated = 0;
+
+    for (const auto& [key, value] : map) {
+        ASSERT_EQ(expected.at(key), value);
+        ++iterated;
+    }
+
+    ASSERT_EQ(iterated, expected.size());
+}
+
+TEST(FlatHashMap, MovedFromIsEmptyAndReusable) {
+    TestFlatHashMap map;
+
+    for (size_t i = 0; i < 100; ++i) {
+        map.emplace(makeKey(i), i);
+    }
+
+    TestFlatHashMap moved(std::move(map));
+    ASSERT_EQ(moved.size(), 100);
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.begin() == map.end());
+
+    for (size_t i = 0; i < 10; ++i) {
+        map.emplace(makeKey(i), i);
+    }
+
+    TestFlatHashMap assigned;
+    assigned = std::move(map);
+    ASSERT_EQ(assigned.size(), 10);
+    ASSERT_TRUE(map.empty());
+
+    map[makeKey(1)] = 1;
+
+    size_t iterated = 0;
+
+    for (const auto& [key, value] : map) {
+        ASSERT_EQ(key, makeKey(1));
+        ASSERT_EQ(value, 1);
+        ++iterated;
+    }
+
+    ASSERT_EQ(iterated, 1);
+    ASSERT_EQ(map.at(makeKey(1)), 1);
+}
+
+TEST(FlatHashMap, AtThrowsOnMissingKey) {
+    TestFlatHashMap map;
+    map[makeKey(1)] = 1;
+
+    const TestFlatHashMap& constMap = map;
+
+    ASSERT_THROW(map.at(makeKey(2)), std::out_of_range);
+    ASSERT_THROW(constMap.at(makeKey(2)), std::out_of_range);
+    ASSERT_EQ(constMap.at(makeKey(1)), 1);
+}
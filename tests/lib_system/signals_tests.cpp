@@ -3,7 +3,10 @@
 #include <lib/system/timer.hpp>
 #include <lib/system/console.hpp>
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <thread>
 
 TEST(Signals, BaseSignalUsingByPointer) {
     static const std::string expectedString = "Hello, world!";
@@ -401,3 +404,154 @@ TEST(Signals, ArgumentsCopy) {
     ASSERT_EQ(isCopied, true);
     ASSERT_EQ(checker.value, 0);
 }
+
+TEST(Signals, MethodSlotIsStoredInside) {
+    class A {
+    public slots:
+        void onSignal(const std::string&) {
+        }
+    };
+
+    using Slot = cs::cshelper::MethodSlotFor<A*, decltype(&A::onSignal)>;
+    static_assert(sizeof(Slot) <= cs::Signal<void(const std::string&)>::Argument::kBufferSize);
+}
+
+TEST(Signals, DisconnectsSameMethodOnly) {
+    class A {
+    public:
+        size_t firstCalls = 0;
+        size_t secondCalls = 0;
+
+    public slots:
+        void onFirst() {
+            ++firstCalls;
+        }
+
+        void onSecond() {
+            ++secondCalls;
+        }
+    };
+
+    cs::Signal<void()> signal;
+    A a;
+
+    cs::Connector::connect(&signal, &a, &A::onFirst);
+    cs::Connector::connect(&signal, &a, &A::onSecond);
+
+    ASSERT_TRUE(cs::Connector::disconnect(&signal, &a, &A::onSecond));
+    ASSERT_FALSE(cs::Connector::disconnect(&signal, &a, &A::onSecond));
+
+    emit signal();
+
+    ASSERT_EQ(a.firstCalls, 1);
+    ASSERT_EQ(a.secondCalls, 0);
+}
+
+TEST(Signals, DisconnectFromSlot) {
+    class A {
+    public:
+        explicit A(cs::Signal<void()>* signal)
+        : signal_(signal) {
+        }
+
+        size_t callsCount = 0;
+
+    public slots:
+        void onSignal() {
+            ++callsCount;
+            cs::Connector::disconnect(signal_, this, &A::onSignal);
+        }
+
+    private:
+        cs::Signal<void()>* signal_;
+    };
+
+    cs::Signal<void()> signal;
+    A first(&signal);
+    A second(&signal);
+
+    cs::Connector::connect(&signal, &first, &A::onSignal);
+    cs::Connector::connect(&signal, &second, &A::onSignal);
+
+    // emission goes on with slots it has started with
+    emit signal();
+    emit signal();
+
+    ASSERT_EQ(first.callsCount, 1);
+    ASSERT_EQ(second.callsCount, 1);
+    ASSERT_EQ(cs::Connector::callbacks(&signal), 0);
+}
+
+TEST(Signals, ConnectWhileEmitting) {
+    constexpr size_t connectionsCount = 1000;
+
+    cs::Signal<void()> signal;
+    std::atomic<size_t> callsCount = 0;
+    std::atomic<bool> isDone = false;
+
+    cs::Connector::connect(&signal, [&] {
+        callsCount.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    std::thread emitter([&] {
+        while (!isDone.load()) {
+            emit signal();
+        }
+    });
+
+    auto dummy = [] {};
+    size_t disconnections = 0;
+
+    for (size_t i = 0; i < connectionsCount; ++i) {
+        cs::Connector::connect(&signal, dummy);
+        disconnections += cs::Connector::disconnect(&signal, dummy);
+    }
+
+    isDone = true;
+    emitter.join();
+
+    ASSERT_EQ(disconnections, connectionsCount);
+
+    const size_t calls = callsCount.load();
+    emit signal();
+
+    ASSERT_EQ(cs::Connector::callbacks(&signal), 1);
+    ASSERT_EQ(callsCount.load(), calls + 1);
+}
+
+TEST(Signals, FreesReplacedSlotsAfterEmission) {
+    cs::Signal<void()> signal;
+    auto token = std::make_shared<int>(0);
+    std::atomic<bool> isEntered = false;
+    std::atomic<bool> isReleased = false;
+
+    cs::Connector::connect(&signal, [token, &isEntered, &isReleased] {
+        isEntered = true;
+
+        while (!isReleased.load()) {
+            std::this_thread::yield();
+        }
+    });
+
+    std::thread emitter([&] {
+        emit signal();
+    });
+
+    while (!isEntered.load()) {
+        std::this_thread::yield();
+    }
+
+    cs::Connector::disconnect(&signal);
+    EXPECT_GT(token.use_count(), 1);
+
+    isReleased = true;
+    emitter.join();
+
+    ASSERT_EQ(token.use_count(), 1);
+
+    cs::Connector::connect(&signal, [token] {});
+    ASSERT_EQ(token.use_count(), 2);
+
+    cs::Connector::disconnect(&signal);
+    ASSERT_EQ(token.use_count(), 1);
+}